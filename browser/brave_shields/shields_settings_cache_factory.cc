@@ -0,0 +1,48 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/brave_shields/shields_settings_cache_factory.h"
+
+#include "brave/components/brave_shields/browser/shields_settings_cache.h"
+#include "chrome/browser/content_settings/host_content_settings_map_factory.h"
+#include "chrome/browser/profiles/incognito_helpers.h"
+#include "components/keyed_service/content/browser_context_dependency_manager.h"
+
+namespace brave_shields {
+
+// static
+ShieldsSettingsCacheFactory* ShieldsSettingsCacheFactory::GetInstance() {
+  return base::Singleton<ShieldsSettingsCacheFactory>::get();
+}
+
+// static
+ShieldsSettingsCache* ShieldsSettingsCacheFactory::GetForContext(
+    content::BrowserContext* context) {
+  return static_cast<ShieldsSettingsCache*>(
+      GetInstance()->GetServiceForBrowserContext(context, true));
+}
+
+ShieldsSettingsCacheFactory::ShieldsSettingsCacheFactory()
+    : BrowserContextKeyedServiceFactory(
+          "ShieldsSettingsCache",
+          BrowserContextDependencyManager::GetInstance()) {
+  DependsOn(HostContentSettingsMapFactory::GetInstance());
+}
+
+ShieldsSettingsCacheFactory::~ShieldsSettingsCacheFactory() = default;
+
+KeyedService* ShieldsSettingsCacheFactory::BuildServiceInstanceFor(
+    content::BrowserContext* context) const {
+  return new ShieldsSettingsCache(
+      HostContentSettingsMapFactory::GetForProfile(context));
+}
+
+content::BrowserContext* ShieldsSettingsCacheFactory::GetBrowserContextToUse(
+    content::BrowserContext* context) const {
+  // Incognito profiles have their own HostContentSettingsMap.
+  return chrome::GetBrowserContextOwnInstanceInIncognito(context);
+}
+
+}  // namespace brave_shields
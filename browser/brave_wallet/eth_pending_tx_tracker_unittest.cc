@@ -6,10 +6,16 @@
 #include "brave/components/brave_wallet/browser/eth_pending_tx_tracker.h"
 
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "base/functional/bind.h"
+#include "base/json/json_reader.h"
+#include "base/json/json_writer.h"
+#include "base/run_loop.h"
 #include "base/test/bind.h"
+#include "base/time/time.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
 #include "brave/components/brave_wallet/browser/eth_nonce_tracker.h"
 #include "brave/components/brave_wallet/browser/eth_transaction.h"
@@ -60,11 +66,15 @@ class EthPendingTxTrackerUnitTest : public testing::Test {
   }
 
   void WaitForResponse() { task_environment_.RunUntilIdle(); }
+  void FastForwardBy(base::TimeDelta delta) {
+    task_environment_.FastForwardBy(delta);
+  }
 
  private:
   network::TestURLLoaderFactory url_loader_factory_;
   scoped_refptr<network::SharedURLLoaderFactory> shared_url_loader_factory_;
-  content::BrowserTaskEnvironment task_environment_;
+  content::BrowserTaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
   std::unique_ptr<TestingProfile> profile_;
   data_decoder::test::InProcessDataDecoder in_process_data_decoder_;
 };
@@ -225,4 +235,154 @@ TEST_F(EthPendingTxTrackerUnitTest, UpdatePendingTransactions) {
             "0xb60e8dd61c5d32be8058bb8eb970870f07233155");
 }
 
+TEST_F(EthPendingTxTrackerUnitTest, UpdatePendingTransactionsInBatch) {
+  const std::string tx_hash1 =
+      "0xb903239f8543d04b5dc1ba6579132b143087c68db1b2168786408fcbce568238";
+  const std::string tx_hash2 =
+      "0xb903239f8543d04b5dc1ba6579132b143087c68db1b2168786408fcbce568239";
+  JsonRpcService service(shared_url_loader_factory(), GetPrefs());
+  EthTxStateManager tx_state_manager(GetPrefs(), &service);
+  EthNonceTracker nonce_tracker(&tx_state_manager, &service);
+  EthPendingTxTracker pending_tx_tracker(&tx_state_manager, &service,
+                                         &nonce_tracker);
+  base::RunLoop().RunUntilIdle();
+  EthTxMeta meta;
+  meta.set_from(
+      EthAddress::FromHex("0x2f015c60e0be116b1f0cd534704db9c92118fb6a")
+          .ToChecksumAddress());
+  meta.set_status(mojom::TransactionStatus::Submitted);
+  meta.set_id("001");
+  meta.set_tx_hash(tx_hash1);
+  meta.tx()->set_nonce(uint256_t(1));
+  tx_state_manager.AddOrUpdateTx(meta);
+  meta.set_id("002");
+  meta.set_tx_hash(tx_hash2);
+  meta.tx()->set_nonce(uint256_t(2));
+  tx_state_manager.AddOrUpdateTx(meta);
+
+  // Batch-aware fake endpoint answering in reverse order, with a receipt for
+  // the first transaction only.
+  size_t num_requests = 0;
+  test_url_loader_factory()->SetInterceptor(
+      base::BindLambdaForTesting([&](const network::ResourceRequest& request) {
+        ++num_requests;
+        base::StringPiece request_string(request.request_body->elements()
+                                             ->at(0)
+                                             .As<network::DataElementBytes>()
+                                             .AsStringPiece());
+        auto batch = base::JSONReader::Read(request_string);
+        ASSERT_TRUE(batch && batch->is_list());
+        base::Value::List responses;
+        for (const auto& batch_request : batch->GetList()) {
+          const auto& batch_request_dict = batch_request.GetDict();
+          EXPECT_EQ(*batch_request_dict.FindString("method"),
+                    "eth_getTransactionReceipt");
+          base::Value::Dict response;
+          response.Set("jsonrpc", "2.0");
+          response.Set("id", batch_request_dict.FindInt("id").value());
+          const auto& params = *batch_request_dict.FindList("params");
+          if (params[0].GetString() == tx_hash1) {
+            response.Set("result", base::JSONReader::Read(R"({
+              "transactionHash": ")" + tx_hash1 + R"(",
+              "transactionIndex": "0x1",
+              "blockNumber": "0xb",
+              "blockHash": "0xc6ef2fc5426d6ad6fd9e2a26abeab0aa2411b7ab17f30a99d3cb96aed1d1055b",
+              "cumulativeGasUsed": "0x33bc",
+              "gasUsed": "0x4dc",
+              "contractAddress": "0xb60e8dd61c5d32be8058bb8eb970870f07233155",
+              "logs": [],
+              "logsBloom": "0x00...0",
+              "status": "0x1"
+            })")
+                                       .value());
+          } else {
+            response.Set("result", base::Value());
+          }
+          responses.Insert(responses.begin(), base::Value(std::move(response)));
+        }
+        std::string response_string;
+        base::JSONWriter::Write(responses, &response_string);
+        test_url_loader_factory()->ClearResponses();
+        test_url_loader_factory()->AddResponse(request.url.spec(),
+                                               response_string);
+      }));
+
+  size_t num_pending;
+  EXPECT_TRUE(pending_tx_tracker.UpdatePendingTransactions(&num_pending));
+  EXPECT_EQ(2UL, num_pending);
+  WaitForResponse();
+  EXPECT_EQ(num_requests, 1u);
+
+  auto meta_from_state = tx_state_manager.GetEthTx("001");
+  ASSERT_NE(meta_from_state, nullptr);
+  EXPECT_EQ(meta_from_state->status(), mojom::TransactionStatus::Confirmed);
+  EXPECT_EQ(meta_from_state->tx_receipt().transaction_hash, tx_hash1);
+  meta_from_state = tx_state_manager.GetEthTx("002");
+  ASSERT_NE(meta_from_state, nullptr);
+  EXPECT_EQ(meta_from_state->status(), mojom::TransactionStatus::Submitted);
+}
+
+TEST_F(EthPendingTxTrackerUnitTest, BatchRequestFailureBacksOff) {
+  JsonRpcService service(shared_url_loader_factory(), GetPrefs());
+  base::RunLoop().RunUntilIdle();
+
+  // Endpoint without batch support: a batch gets a single error object back.
+  size_t num_batch_requests = 0;
+  size_t num_single_requests = 0;
+  test_url_loader_factory()->SetInterceptor(
+      base::BindLambdaForTesting([&](const network::ResourceRequest& request) {
+        base::StringPiece request_string(request.request_body->elements()
+                                             ->at(0)
+                                             .As<network::DataElementBytes>()
+                                             .AsStringPiece());
+        auto payload = base::JSONReader::Read(request_string);
+        ASSERT_TRUE(payload);
+        test_url_loader_factory()->ClearResponses();
+        if (payload->is_list()) {
+          ++num_batch_requests;
+          test_url_loader_factory()->AddResponse(
+              request.url.spec(),
+              R"({"jsonrpc":"2.0","id":null,)"
+              R"("error":{"code":-32600,"message":"Invalid request"}})");
+        } else {
+          ++num_single_requests;
+          test_url_loader_factory()->AddResponse(
+              request.url.spec(), R"({"jsonrpc":"2.0","id":1,"result":null})");
+        }
+      }));
+
+  const std::vector<std::string> tx_hashes = {
+      "0xb903239f8543d04b5dc1ba6579132b143087c68db1b2168786408fcbce568238",
+      "0xb903239f8543d04b5dc1ba6579132b143087c68db1b2168786408fcbce568239"};
+  auto get_receipts = [&]() {
+    size_t num_receipts = 0;
+    service.GetTransactionReceipts(
+        tx_hashes,
+        base::BindLambdaForTesting(
+            [&](std::vector<absl::optional<TransactionReceipt>> receipts) {
+              num_receipts = receipts.size();
+            }));
+    WaitForResponse();
+    EXPECT_EQ(num_receipts, tx_hashes.size());
+  };
+
+  // The failed batch falls back to one request per transaction.
+  get_receipts();
+  EXPECT_EQ(num_batch_requests, 1u);
+  EXPECT_EQ(num_single_requests, 2u);
+
+  // Batching isn't tried again during the backoff.
+  FastForwardBy(base::Minutes(kJsonRpcBatchBackoffTimeInMinutes) -
+                base::Seconds(1));
+  get_receipts();
+  EXPECT_EQ(num_batch_requests, 1u);
+  EXPECT_EQ(num_single_requests, 4u);
+
+  // It is once the backoff has passed.
+  FastForwardBy(base::Seconds(1));
+  get_receipts();
+  EXPECT_EQ(num_batch_requests, 2u);
+  EXPECT_EQ(num_single_requests, 6u);
+}
+
 }  // namespace brave_wallet
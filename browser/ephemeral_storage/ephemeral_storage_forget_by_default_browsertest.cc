@@ -5,7 +5,12 @@
 
 #include "brave/browser/ephemeral_storage/ephemeral_storage_browsertest.h"
 
+#include "base/run_loop.h"
+#include "base/scoped_observation.h"
+#include "base/task/sequenced_task_runner.h"
+#include "base/time/time.h"
 #include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "brave/components/ephemeral_storage/ephemeral_storage_pref_names.h"
 #include "chrome/browser/content_settings/cookie_settings_factory.h"
 #include "chrome/browser/content_settings/host_content_settings_map_factory.h"
 #include "chrome/browser/profiles/profile.h"
@@ -13,12 +18,62 @@
 #include "chrome/test/base/ui_test_utils.h"
 #include "components/content_settings/core/browser/cookie_settings.h"
 #include "components/content_settings/core/browser/host_content_settings_map.h"
+#include "components/prefs/pref_service.h"
+#include "content/public/browser/browser_context.h"
+#include "content/public/browser/browsing_data_remover.h"
 #include "content/public/test/browser_test.h"
 #include "net/base/features.h"
+#include "url/origin.h"
 
 using content::RenderFrameHost;
 using content::WebContents;
 
+namespace {
+
+// Counts the removals the BrowsingDataRemover has completed. Each batch of
+// first party storage areas is cleaned up with one removal.
+class BrowsingDataRemovalCounter
+    : public content::BrowsingDataRemover::Observer {
+ public:
+  explicit BrowsingDataRemovalCounter(content::BrowsingDataRemover* remover) {
+    observation_.Observe(remover);
+  }
+
+  size_t count() const { return count_; }
+
+  void WaitForCount(size_t count) {
+    while (count_ < count) {
+      base::RunLoop run_loop;
+      quit_closure_ = run_loop.QuitClosure();
+      run_loop.Run();
+    }
+  }
+
+  // content::BrowsingDataRemover::Observer:
+  void OnBrowsingDataRemoverDone(uint64_t failed_data_types) override {
+    ++count_;
+    if (quit_closure_) {
+      std::move(quit_closure_).Run();
+    }
+  }
+
+ private:
+  size_t count_ = 0;
+  base::OnceClosure quit_closure_;
+  base::ScopedObservation<content::BrowsingDataRemover,
+                          content::BrowsingDataRemover::Observer>
+      observation_{this};
+};
+
+void WaitFor(base::TimeDelta delay) {
+  base::RunLoop run_loop;
+  base::SequencedTaskRunner::GetCurrentDefault()->PostDelayedTask(
+      FROM_HERE, run_loop.QuitClosure(), delay);
+  run_loop.Run();
+}
+
+}  // namespace
+
 class EphemeralStorageForgetByDefaultBrowserTest
     : public EphemeralStorageBrowserTest {
  public:
@@ -30,6 +85,11 @@ class EphemeralStorageForgetByDefaultBrowserTest
   ~EphemeralStorageForgetByDefaultBrowserTest() override = default;
 
  protected:
+  const base::Value::List& GetOriginsToCleanup() {
+    return browser()->profile()->GetPrefs()->GetList(
+        ephemeral_storage::kFirstPartyStorageOriginsToCleanup);
+  }
+
   base::test::ScopedFeatureList scoped_feature_list_;
 };
 
@@ -198,6 +258,83 @@ IN_PROC_BROWSER_TEST_F(EphemeralStorageForgetByDefaultBrowserTest,
   EXPECT_EQ("", values_site_b.iframe_2.cookies);
 }
 
+IN_PROC_BROWSER_TEST_F(EphemeralStorageForgetByDefaultBrowserTest,
+                       OriginsAreCleanedUpInOneBatch) {
+  brave_shields::SetCookieControlType(
+      content_settings(), browser()->profile()->GetPrefs(),
+      brave_shields::ControlType::FORGET_FIRST_PARTY,
+      a_site_ephemeral_storage_url_);
+  brave_shields::SetCookieControlType(
+      content_settings(), browser()->profile()->GetPrefs(),
+      brave_shields::ControlType::FORGET_FIRST_PARTY,
+      b_site_ephemeral_storage_url_);
+
+  const GURL a_site_set_cookie_url = https_server_.GetURL(
+      "a.com", "/set-cookie?name=acom;path=/;SameSite=None;Secure;Max-Age=600");
+  const GURL b_site_set_cookie_url = https_server_.GetURL(
+      "b.com", "/set-cookie?name=bcom;path=/;SameSite=None;Secure;Max-Age=600");
+  WebContents* site_a = LoadURLInNewTab(a_site_set_cookie_url);
+  WebContents* site_b = LoadURLInNewTab(b_site_set_cookie_url);
+  EXPECT_EQ(2u, GetAllCookies().size());
+
+  BrowsingDataRemovalCounter removal_counter(
+      browser()->profile()->GetBrowsingDataRemover());
+
+  // Both origins become unused well within the batch window of each other.
+  ASSERT_TRUE(content::NavigateToURL(site_a, c_site_ephemeral_storage_url_));
+  ASSERT_TRUE(content::NavigateToURL(site_b, c_site_ephemeral_storage_url_));
+  EXPECT_EQ(2u, GetOriginsToCleanup().size());
+
+  removal_counter.WaitForCount(1);
+  EXPECT_TRUE(GetOriginsToCleanup().empty());
+  EXPECT_EQ(0u, GetAllCookies().size());
+
+  // Nothing is left to clean up after the batch.
+  WaitForCleanupAfterKeepAlive();
+  EXPECT_EQ(1u, removal_counter.count());
+}
+
+IN_PROC_BROWSER_TEST_F(EphemeralStorageForgetByDefaultBrowserTest,
+                       OriginsOutsideBatchWindowAreCleanedUpSeparately) {
+  brave_shields::SetCookieControlType(
+      content_settings(), browser()->profile()->GetPrefs(),
+      brave_shields::ControlType::FORGET_FIRST_PARTY,
+      a_site_ephemeral_storage_url_);
+  brave_shields::SetCookieControlType(
+      content_settings(), browser()->profile()->GetPrefs(),
+      brave_shields::ControlType::FORGET_FIRST_PARTY,
+      b_site_ephemeral_storage_url_);
+
+  const GURL a_site_set_cookie_url = https_server_.GetURL(
+      "a.com", "/set-cookie?name=acom;path=/;SameSite=None;Secure;Max-Age=600");
+  const GURL b_site_set_cookie_url = https_server_.GetURL(
+      "b.com", "/set-cookie?name=bcom;path=/;SameSite=None;Secure;Max-Age=600");
+  WebContents* site_a = LoadURLInNewTab(a_site_set_cookie_url);
+  WebContents* site_b = LoadURLInNewTab(b_site_set_cookie_url);
+  EXPECT_EQ(2u, GetAllCookies().size());
+
+  BrowsingDataRemovalCounter removal_counter(
+      browser()->profile()->GetBrowsingDataRemover());
+
+  // b.com becomes unused more than the one second batch window after a.com.
+  ASSERT_TRUE(content::NavigateToURL(site_a, c_site_ephemeral_storage_url_));
+  WaitFor(base::Milliseconds(1500));
+  ASSERT_TRUE(content::NavigateToURL(site_b, c_site_ephemeral_storage_url_));
+  EXPECT_EQ(2u, GetOriginsToCleanup().size());
+
+  // a.com is cleaned up on its own.
+  removal_counter.WaitForCount(1);
+  ASSERT_EQ(1u, GetOriginsToCleanup().size());
+  EXPECT_EQ(url::Origin::Create(b_site_set_cookie_url).Serialize(),
+            GetOriginsToCleanup()[0].GetString());
+  EXPECT_EQ(1u, GetAllCookies().size());
+
+  // b.com follows in a second batch.
+  removal_counter.WaitForCount(2);
+  EXPECT_TRUE(GetOriginsToCleanup().empty());
+  EXPECT_EQ(0u, GetAllCookies().size());
+}
+
 IN_PROC_BROWSER_TEST_F(EphemeralStorageForgetByDefaultBrowserTest,
                        PRE_ForgetFirstPartyAfterRestart) {
   const GURL a_site_set_cookie_url(
@@ -5,14 +5,17 @@
 
 #include "brave/browser/net/brave_query_filter.h"
 
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/containers/fixed_flat_map.h"
 #include "base/containers/fixed_flat_set.h"
+#include "base/containers/flat_map.h"
+#include "base/no_destructor.h"
 #include "base/strings/string_piece.h"
-#include "base/strings/string_split.h"
-#include "base/strings/string_util.h"
+#include "brave/components/url_sanitizer/common/query_string_stripper.h"
 #include "third_party/re2/src/re2/re2.h"
 #include "url/gurl.h"
 
@@ -74,60 +77,54 @@ static constexpr auto kScopedQueryStringTrackers =
         {"ref_url", "twitter.com"},
     });
 
-// Remove tracking query parameters from a GURL, leaving all
-// other parts untouched.
-absl::optional<std::string> StripQueryParameter(const base::StringPiece& query,
-                                                const std::string& spec) {
-  // We are using custom query string parsing code here. See
-  // https://github.com/brave/brave-core/pull/13726#discussion_r897712350
-  // for more information on why this approach was selected.
-  //
-  // Split query string by ampersands, remove tracking parameters,
-  // then join the remaining query parameters, untouched, back into
-  // a single query string.
-  const std::vector<base::StringPiece> input_kv_strings =
-      SplitStringPiece(query, "&", base::KEEP_WHITESPACE, base::SPLIT_WANT_ALL);
-  std::vector<base::StringPiece> output_kv_strings;
-  int disallowed_count = 0;
-  for (const auto& kv_string : input_kv_strings) {
-    const std::vector<base::StringPiece> pieces = SplitStringPiece(
-        kv_string, "=", base::KEEP_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
-    const base::StringPiece& key = pieces.empty() ? "" : pieces[0];
-    if (pieces.size() >= 2 &&
-        (kSimpleQueryStringTrackers.count(key) == 1 ||
-         (kScopedQueryStringTrackers.count(key) == 1 &&
-          GURL(spec).DomainIs(kScopedQueryStringTrackers.at(key).data())) ||
-         (kConditionalQueryStringTrackers.count(key) == 1 &&
-          !re2::RE2::PartialMatch(
-              spec, kConditionalQueryStringTrackers.at(key).data())))) {
-      ++disallowed_count;
-    } else {
-      output_kv_strings.push_back(kv_string);
-    }
+const re2::RE2* GetConditionalQueryStringTrackerRegex(base::StringPiece key) {
+  // Compiled once, the patterns are constants.
+  static const base::NoDestructor<
+      base::flat_map<base::StringPiece, std::unique_ptr<re2::RE2>>>
+      regexes([] {
+        std::vector<std::pair<base::StringPiece, std::unique_ptr<re2::RE2>>>
+            result;
+        for (const auto& [tracker, pattern] :
+             kConditionalQueryStringTrackers) {
+          result.emplace_back(tracker,
+                              std::make_unique<re2::RE2>(std::string(pattern)));
+        }
+        return base::flat_map<base::StringPiece, std::unique_ptr<re2::RE2>>(
+            std::move(result));
+      }());
+  const auto it = regexes->find(key);
+  return it != regexes->end() ? it->second.get() : nullptr;
+}
+
+bool IsTrackingQueryParameter(const GURL& url, base::StringPiece key) {
+  if (kSimpleQueryStringTrackers.contains(key)) {
+    return true;
   }
-  if (disallowed_count > 0) {
-    return base::JoinString(output_kv_strings, "&");
+
+  const auto scoped_tracker = kScopedQueryStringTrackers.find(key);
+  if (scoped_tracker != kScopedQueryStringTrackers.end()) {
+    return url.DomainIs(scoped_tracker->second);
   }
-  return absl::nullopt;
+
+  const re2::RE2* regex = GetConditionalQueryStringTrackerRegex(key);
+  return regex && !re2::RE2::PartialMatch(url.spec(), *regex);
 }
 
 }  // namespace
 
 absl::optional<GURL> ApplyQueryFilter(const GURL& original_url) {
-  const auto& query = original_url.query_piece();
-  const std::string& spec = original_url.spec();
-  const auto clean_query_value = StripQueryParameter(query, spec);
-  if (!clean_query_value.has_value())
+  const auto clean_query = brave::StripQueryParameters(
+      original_url.query_piece(), [&original_url](base::StringPiece key) {
+        return IsTrackingQueryParameter(original_url, key);
+      });
+  if (!clean_query.has_value()) {
     return absl::nullopt;
-  const auto& clean_query = clean_query_value.value();
-  if (clean_query.length() < query.length()) {
-    GURL::Replacements replacements;
-    if (clean_query.empty()) {
-      replacements.ClearQuery();
-    } else {
-      replacements.SetQueryStr(clean_query);
-    }
-    return original_url.ReplaceComponents(replacements);
   }
-  return absl::nullopt;
+  GURL::Replacements replacements;
+  if (clean_query->empty()) {
+    replacements.ClearQuery();
+  } else {
+    replacements.SetQueryStr(*clean_query);
+  }
+  return original_url.ReplaceComponents(replacements);
 }
@@ -10,6 +10,12 @@
 
 #include "base/containers/contains.h"
 #include "base/feature_list.h"
+#include "base/functional/callback_helpers.h"
+#include "base/metrics/histogram.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_piece.h"
+#include "base/task/thread_pool.h"
+#include "base/trace_event/trace_event.h"
 #include "brave/browser/net/brave_ad_block_csp_network_delegate_helper.h"
 #include "brave/browser/net/brave_ad_block_tp_network_delegate_helper.h"
 #include "brave/browser/net/brave_ads_status_header_network_delegate_helper.h"
@@ -52,7 +58,24 @@ static bool IsInternalScheme(std::shared_ptr<brave::BraveRequestInfo> ctx) {
   return ctx->request_url.SchemeIs(content::kChromeUIScheme);
 }
 
-BraveRequestHandler::BraveRequestHandler() {
+namespace {
+
+constexpr char kTraceCategory[] = "brave.request_handler";
+
+base::HistogramBase* GetStageHistogram(const char* stage_name,
+                                       base::StringPiece suffix) {
+  return base::Histogram::FactoryMicrosecondsTimeGet(
+      base::StrCat({kRequestHandlerHistogramPrefix, stage_name, suffix}),
+      base::Microseconds(1), base::Seconds(10), 50,
+      base::HistogramBase::kUmaTargetedHistogramFlag);
+}
+
+}  // namespace
+
+BraveRequestHandler::BraveRequestHandler()
+    : task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
+          {base::TaskPriority::USER_BLOCKING,
+           base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN})) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
   SetupCallbacks();
 }
@@ -60,70 +83,138 @@ BraveRequestHandler::BraveRequestHandler() {
 BraveRequestHandler::~BraveRequestHandler() = default;
 
 void BraveRequestHandler::SetupCallbacks() {
-  brave::OnBeforeURLRequestCallback callback =
-      base::BindRepeating(brave::OnBeforeURLRequest_SiteHacksWork);
-  before_url_request_callbacks_.push_back(callback);
-
-  callback = base::BindRepeating(brave::OnBeforeURLRequest_AdBlockTPPreWork);
-  before_url_request_callbacks_.push_back(callback);
-
-  callback = base::BindRepeating(brave::OnBeforeURLRequest_HttpsePreFileWork);
-  before_url_request_callbacks_.push_back(callback);
-
-  callback =
-      base::BindRepeating(brave::OnBeforeURLRequest_CommonStaticRedirectWork);
-  before_url_request_callbacks_.push_back(callback);
-
-  callback = base::BindRepeating(
-      decentralized_dns::OnBeforeURLRequest_DecentralizedDnsPreRedirectWork);
-  before_url_request_callbacks_.push_back(callback);
+  // Referrer capping and the query filter only use fields of the request
+  // context that were filled in on the UI thread by MakeCTX(). The later stages
+  // stay on the UI thread: ad block and HTTPS Everywhere already do their
+  // matching on their own sequences, and the static redirects must run after
+  // them because the last stage to set |new_url_spec| wins.
+  before_url_request_callbacks_.push_back(
+      {"BeforeURLRequest.SiteHacks",
+       base::BindRepeating(brave::OnBeforeURLRequest_SiteHacksWork),
+       /*run_on_task_runner=*/true});
+
+  before_url_request_callbacks_.push_back(
+      {"BeforeURLRequest.AdBlockTP",
+       base::BindRepeating(brave::OnBeforeURLRequest_AdBlockTPPreWork)});
+
+  before_url_request_callbacks_.push_back(
+      {"BeforeURLRequest.Httpse",
+       base::BindRepeating(brave::OnBeforeURLRequest_HttpsePreFileWork)});
+
+  before_url_request_callbacks_.push_back(
+      {"BeforeURLRequest.CommonStaticRedirect",
+       base::BindRepeating(
+           brave::OnBeforeURLRequest_CommonStaticRedirectWork)});
+
+  before_url_request_callbacks_.push_back(
+      {"BeforeURLRequest.DecentralizedDns",
+       base::BindRepeating(
+           decentralized_dns::
+               OnBeforeURLRequest_DecentralizedDnsPreRedirectWork)});
 
 #if BUILDFLAG(ENABLE_IPFS)
   if (base::FeatureList::IsEnabled(ipfs::features::kIpfsFeature)) {
-    callback = base::BindRepeating(ipfs::OnBeforeURLRequest_IPFSRedirectWork);
-    before_url_request_callbacks_.push_back(callback);
+    before_url_request_callbacks_.push_back(
+        {"BeforeURLRequest.IPFSRedirect",
+         base::BindRepeating(ipfs::OnBeforeURLRequest_IPFSRedirectWork)});
   }
 #endif
 
-  brave::OnBeforeStartTransactionCallback start_transaction_callback =
-      base::BindRepeating(brave::OnBeforeStartTransaction_SiteHacksWork);
-  before_start_transaction_callbacks_.push_back(start_transaction_callback);
+  before_start_transaction_callbacks_.push_back(
+      {"BeforeStartTransaction.SiteHacks",
+       base::BindRepeating(brave::OnBeforeStartTransaction_SiteHacksWork)});
 
-  start_transaction_callback = base::BindRepeating(
-      brave::OnBeforeStartTransaction_GlobalPrivacyControlWork);
-  before_start_transaction_callbacks_.push_back(start_transaction_callback);
+  before_start_transaction_callbacks_.push_back(
+      {"BeforeStartTransaction.GlobalPrivacyControl",
+       base::BindRepeating(
+           brave::OnBeforeStartTransaction_GlobalPrivacyControlWork)});
 
-  start_transaction_callback =
-      base::BindRepeating(brave::OnBeforeStartTransaction_BraveServiceKey);
-  before_start_transaction_callbacks_.push_back(start_transaction_callback);
+  before_start_transaction_callbacks_.push_back(
+      {"BeforeStartTransaction.BraveServiceKey",
+       base::BindRepeating(brave::OnBeforeStartTransaction_BraveServiceKey)});
 
-  start_transaction_callback =
-      base::BindRepeating(brave::OnBeforeStartTransaction_ReferralsWork);
-  before_start_transaction_callbacks_.push_back(start_transaction_callback);
+  before_start_transaction_callbacks_.push_back(
+      {"BeforeStartTransaction.Referrals",
+       base::BindRepeating(brave::OnBeforeStartTransaction_ReferralsWork)});
 
   if (base::FeatureList::IsEnabled(
           brave_shields::features::kBraveReduceLanguage)) {
-    start_transaction_callback =
-        base::BindRepeating(brave::OnBeforeStartTransaction_ReduceLanguageWork);
-    before_start_transaction_callbacks_.push_back(start_transaction_callback);
+    before_start_transaction_callbacks_.push_back(
+        {"BeforeStartTransaction.ReduceLanguage",
+         base::BindRepeating(
+             brave::OnBeforeStartTransaction_ReduceLanguageWork)});
   }
 
-  start_transaction_callback =
-      base::BindRepeating(brave::OnBeforeStartTransaction_AdsStatusHeader);
-  before_start_transaction_callbacks_.push_back(start_transaction_callback);
+  before_start_transaction_callbacks_.push_back(
+      {"BeforeStartTransaction.AdsStatusHeader",
+       base::BindRepeating(brave::OnBeforeStartTransaction_AdsStatusHeader)});
 
 #if BUILDFLAG(ENABLE_BRAVE_WEBTORRENT)
-  brave::OnHeadersReceivedCallback headers_received_callback =
-      base::BindRepeating(webtorrent::OnHeadersReceived_TorrentRedirectWork);
-  headers_received_callbacks_.push_back(headers_received_callback);
+  headers_received_callbacks_.push_back(
+      {"HeadersReceived.TorrentRedirect",
+       base::BindRepeating(webtorrent::OnHeadersReceived_TorrentRedirectWork)});
 #endif
 
   if (base::FeatureList::IsEnabled(
           ::brave_shields::features::kBraveAdblockCspRules)) {
-    brave::OnHeadersReceivedCallback headers_received_callback2 =
-        base::BindRepeating(brave::OnHeadersReceived_AdBlockCspWork);
-    headers_received_callbacks_.push_back(headers_received_callback2);
+    headers_received_callbacks_.push_back(
+        {"HeadersReceived.AdBlockCsp",
+         base::BindRepeating(brave::OnHeadersReceived_AdBlockCspWork)});
+  }
+
+  SetupStageHistograms(&before_url_request_callbacks_);
+  SetupStageHistograms(&before_start_transaction_callbacks_);
+  SetupStageHistograms(&headers_received_callbacks_);
+}
+
+// static
+template <typename Callback>
+void BraveRequestHandler::SetupStageHistograms(
+    std::vector<Stage<Callback>>* stages) {
+  for (auto& stage : *stages) {
+    stage.sync_time_histogram = GetStageHistogram(stage.name, ".SyncTime");
+    stage.async_time_histogram = GetStageHistogram(stage.name, ".AsyncTime");
+  }
+}
+
+template <typename Callback, typename... Args>
+int BraveRequestHandler::RunStage(const Stage<Callback>& stage,
+                                  std::shared_ptr<brave::BraveRequestInfo> ctx,
+                                  Args... args) {
+  TRACE_EVENT0(kTraceCategory, stage.name);
+  brave::ResponseCallback next_callback = base::BindRepeating(
+      &BraveRequestHandler::OnPendingStageDone, weak_factory_.GetWeakPtr(),
+      stage.name, stage.async_time_histogram.get(), ctx);
+  const base::TimeTicks start_time = base::TimeTicks::Now();
+  const int rv = stage.callback.Run(args..., next_callback, ctx);
+  const base::TimeTicks end_time = base::TimeTicks::Now();
+  stage.sync_time_histogram->AddTimeMicrosecondsGranularity(end_time -
+                                                            start_time);
+  if (rv == net::ERR_IO_PENDING) {
+    ctx->pending_stage_name = stage.name;
+    ctx->pending_stage_start_time = end_time;
+    TRACE_EVENT_NESTABLE_ASYNC_BEGIN0(
+        kTraceCategory, stage.name,
+        TRACE_ID_WITH_SCOPE(stage.name, ctx->request_identifier));
+  }
+  return rv;
+}
+
+void BraveRequestHandler::OnPendingStageDone(
+    const char* stage_name,
+    base::HistogramBase* async_time_histogram,
+    std::shared_ptr<brave::BraveRequestInfo> ctx) {
+  // Cleared by OnURLRequestDestroyed() if the request went away first.
+  if (ctx->pending_stage_name) {
+    async_time_histogram->AddTimeMicrosecondsGranularity(
+        base::TimeTicks::Now() - ctx->pending_stage_start_time);
+    ctx->pending_stage_name = nullptr;
+    ctx->pending_stage_start_time = base::TimeTicks();
+    TRACE_EVENT_NESTABLE_ASYNC_END0(
+        kTraceCategory, stage_name,
+        TRACE_ID_WITH_SCOPE(stage_name, ctx->request_identifier));
   }
+  RunNextCallback(ctx);
 }
 
 bool BraveRequestHandler::IsRequestIdentifierValid(
@@ -189,6 +280,13 @@ int BraveRequestHandler::OnHeadersReceived(
 
 void BraveRequestHandler::OnURLRequestDestroyed(
     std::shared_ptr<brave::BraveRequestInfo> ctx) {
+  if (ctx->pending_stage_name) {
+    TRACE_EVENT_NESTABLE_ASYNC_END0(
+        kTraceCategory, ctx->pending_stage_name,
+        TRACE_ID_WITH_SCOPE(ctx->pending_stage_name, ctx->request_identifier));
+    ctx->pending_stage_name = nullptr;
+    ctx->pending_stage_start_time = base::TimeTicks();
+  }
   if (base::Contains(callbacks_, ctx->request_identifier)) {
     callbacks_.erase(ctx->request_identifier);
   }
@@ -227,12 +325,13 @@ void BraveRequestHandler::RunNextCallback(
   if (ctx->event_type == brave::kOnBeforeRequest) {
     while (before_url_request_callbacks_.size() !=
            ctx->next_url_request_index) {
-      brave::OnBeforeURLRequestCallback callback =
-          before_url_request_callbacks_[ctx->next_url_request_index++];
-      brave::ResponseCallback next_callback =
-          base::BindRepeating(&BraveRequestHandler::RunNextCallback,
-                              weak_factory_.GetWeakPtr(), ctx);
-      rv = callback.Run(next_callback, ctx);
+      if (before_url_request_callbacks_[ctx->next_url_request_index]
+              .run_on_task_runner) {
+        RunNextStagesOnTaskRunner(ctx);
+        return;
+      }
+      rv = RunStage(
+          before_url_request_callbacks_[ctx->next_url_request_index++], ctx);
       if (rv == net::ERR_IO_PENDING) {
         return;
       }
@@ -243,12 +342,9 @@ void BraveRequestHandler::RunNextCallback(
   } else if (ctx->event_type == brave::kOnBeforeStartTransaction) {
     while (before_start_transaction_callbacks_.size() !=
            ctx->next_url_request_index) {
-      brave::OnBeforeStartTransactionCallback callback =
-          before_start_transaction_callbacks_[ctx->next_url_request_index++];
-      brave::ResponseCallback next_callback =
-          base::BindRepeating(&BraveRequestHandler::RunNextCallback,
-                              weak_factory_.GetWeakPtr(), ctx);
-      rv = callback.Run(ctx->headers, next_callback, ctx);
+      rv = RunStage(
+          before_start_transaction_callbacks_[ctx->next_url_request_index++],
+          ctx, ctx->headers);
       if (rv == net::ERR_IO_PENDING) {
         return;
       }
@@ -258,14 +354,10 @@ void BraveRequestHandler::RunNextCallback(
     }
   } else if (ctx->event_type == brave::kOnHeadersReceived) {
     while (headers_received_callbacks_.size() != ctx->next_url_request_index) {
-      brave::OnHeadersReceivedCallback callback =
-          headers_received_callbacks_[ctx->next_url_request_index++];
-      brave::ResponseCallback next_callback =
-          base::BindRepeating(&BraveRequestHandler::RunNextCallback,
-                              weak_factory_.GetWeakPtr(), ctx);
-      rv = callback.Run(ctx->original_response_headers,
-                        ctx->override_response_headers,
-                        ctx->allowed_unsafe_redirect_url, next_callback, ctx);
+      rv = RunStage(headers_received_callbacks_[ctx->next_url_request_index++],
+                    ctx, ctx->original_response_headers,
+                    ctx->override_response_headers,
+                    ctx->allowed_unsafe_redirect_url);
       if (rv == net::ERR_IO_PENDING) {
         return;
       }
@@ -297,3 +389,58 @@ void BraveRequestHandler::RunNextCallback(
   }
   RunCallbackForRequestIdentifier(ctx->request_identifier, rv);
 }
+
+void BraveRequestHandler::RunNextStagesOnTaskRunner(
+    std::shared_ptr<brave::BraveRequestInfo> ctx) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+
+  std::vector<BeforeURLRequestStage> stages;
+  for (size_t i = ctx->next_url_request_index;
+       i < before_url_request_callbacks_.size() &&
+       before_url_request_callbacks_[i].run_on_task_runner;
+       ++i) {
+    stages.push_back(before_url_request_callbacks_[i]);
+  }
+  DCHECK(!stages.empty());
+
+  // |ctx| is not used on the UI thread until the reply runs.
+  task_runner_->PostTaskAndReplyWithResult(
+      FROM_HERE, base::BindOnce(&BraveRequestHandler::RunStagesSync,
+                                std::move(stages), ctx),
+      base::BindOnce(&BraveRequestHandler::OnStagesOnTaskRunnerDone,
+                     weak_factory_.GetWeakPtr(), ctx));
+}
+
+// static
+int BraveRequestHandler::RunStagesSync(
+    std::vector<BeforeURLRequestStage> stages,
+    std::shared_ptr<brave::BraveRequestInfo> ctx) {
+  for (const auto& stage : stages) {
+    TRACE_EVENT0(kTraceCategory, stage.name);
+    ctx->next_url_request_index++;
+    const base::TimeTicks start_time = base::TimeTicks::Now();
+    const int rv = stage.callback.Run(base::DoNothing(), ctx);
+    stage.sync_time_histogram->AddTimeMicrosecondsGranularity(
+        base::TimeTicks::Now() - start_time);
+    DCHECK_NE(net::ERR_IO_PENDING, rv) << stage.name;
+    if (rv != net::OK) {
+      return rv;
+    }
+  }
+  return net::OK;
+}
+
+void BraveRequestHandler::OnStagesOnTaskRunnerDone(
+    std::shared_ptr<brave::BraveRequestInfo> ctx,
+    int rv) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+
+  if (rv != net::OK) {
+    if (IsRequestIdentifierValid(ctx->request_identifier)) {
+      RunCallbackForRequestIdentifier(ctx->request_identifier, rv);
+    }
+    return;
+  }
+
+  RunNextCallback(ctx);
+}
@@ -11,12 +11,26 @@
 #include <string>
 #include <vector>
 
+#include "base/memory/raw_ptr.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/memory/weak_ptr.h"
+#include "base/task/sequenced_task_runner.h"
 #include "brave/browser/net/url_context.h"
+#include "base/gtest_prod_util.h"
 #include "content/public/browser/browser_thread.h"
 #include "net/base/completion_once_callback.h"
 
 class PrefChangeRegistrar;
 
+namespace base {
+class HistogramBase;
+}  // namespace base
+
+// Every stage records "Brave.RequestHandler.<Event>.<Stage>.SyncTime" and,
+// when it completes asynchronously, ".AsyncTime".
+inline constexpr char kRequestHandlerHistogramPrefix[] =
+    "Brave.RequestHandler.";
+
 // Contains different network stack hooks (similar to capabilities of WebRequest
 // API).
 class BraveRequestHandler {
@@ -46,13 +60,55 @@ class BraveRequestHandler {
   void RunCallbackForRequestIdentifier(uint64_t request_identifier, int rv);
 
  private:
+  FRIEND_TEST_ALL_PREFIXES(BraveRequestHandlerTest, SiteHacksRunOnTaskRunner);
+  FRIEND_TEST_ALL_PREFIXES(BraveRequestHandlerTest,
+                           StagesRunOnTaskRunnerInOrder);
+  FRIEND_TEST_ALL_PREFIXES(BraveRequestHandlerTest,
+                           StageOnTaskRunnerStopsChainOnError);
+
+  template <typename Callback>
+  struct Stage {
+    // Used to name trace events and latency histograms. Must be a literal.
+    const char* name;
+    Callback callback;
+    // Stages which only read and write |ctx| and never return
+    // net::ERR_IO_PENDING can run on |task_runner_| instead of the UI thread.
+    // Only supported for OnBeforeURLRequest stages.
+    bool run_on_task_runner = false;
+    // Looked up once in SetupCallbacks() so the hot path doesn't build
+    // histogram names.
+    raw_ptr<base::HistogramBase> sync_time_histogram = nullptr;
+    raw_ptr<base::HistogramBase> async_time_histogram = nullptr;
+  };
+  using BeforeURLRequestStage = Stage<brave::OnBeforeURLRequestCallback>;
+  using BeforeStartTransactionStage =
+      Stage<brave::OnBeforeStartTransactionCallback>;
+  using HeadersReceivedStage = Stage<brave::OnHeadersReceivedCallback>;
+
   void SetupCallbacks();
+  template <typename Callback>
+  static void SetupStageHistograms(std::vector<Stage<Callback>>* stages);
+  template <typename Callback, typename... Args>
+  int RunStage(const Stage<Callback>& stage,
+               std::shared_ptr<brave::BraveRequestInfo> ctx,
+               Args... args);
+  void OnPendingStageDone(const char* stage_name,
+                          base::HistogramBase* async_time_histogram,
+                          std::shared_ptr<brave::BraveRequestInfo> ctx);
   void RunNextCallback(std::shared_ptr<brave::BraveRequestInfo> ctx);
+  // Runs the consecutive |run_on_task_runner| stages starting at
+  // |ctx->next_url_request_index| with a single hop to |task_runner_|.
+  void RunNextStagesOnTaskRunner(std::shared_ptr<brave::BraveRequestInfo> ctx);
+  static int RunStagesSync(std::vector<BeforeURLRequestStage> stages,
+                           std::shared_ptr<brave::BraveRequestInfo> ctx);
+  void OnStagesOnTaskRunnerDone(std::shared_ptr<brave::BraveRequestInfo> ctx,
+                                int rv);
+
+  scoped_refptr<base::SequencedTaskRunner> task_runner_;
 
-  std::vector<brave::OnBeforeURLRequestCallback> before_url_request_callbacks_;
-  std::vector<brave::OnBeforeStartTransactionCallback>
-      before_start_transaction_callbacks_;
-  std::vector<brave::OnHeadersReceivedCallback> headers_received_callbacks_;
+  std::vector<BeforeURLRequestStage> before_url_request_callbacks_;
+  std::vector<BeforeStartTransactionStage> before_start_transaction_callbacks_;
+  std::vector<HeadersReceivedStage> headers_received_callbacks_;
 
   std::map<uint64_t, net::CompletionOnceCallback> callbacks_;
 
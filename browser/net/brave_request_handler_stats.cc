@@ -0,0 +1,62 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/brave_request_handler_stats.h"
+
+#include <memory>
+#include <utility>
+
+#include "base/metrics/histogram_base.h"
+#include "base/metrics/histogram_samples.h"
+#include "base/metrics/statistics_recorder.h"
+#include "brave/browser/net/brave_request_handler.h"
+
+namespace brave {
+
+int64_t EstimatePercentile(const base::HistogramSamples& samples,
+                           double fraction) {
+  const double target = samples.TotalCount() * fraction;
+  double accumulated = 0;
+  for (auto it = samples.Iterator(); !it->Done(); it->Next()) {
+    base::HistogramBase::Sample min = 0;
+    int64_t max = 0;
+    base::HistogramBase::Count count = 0;
+    it->Get(&min, &max, &count);
+    if (count <= 0) {
+      continue;
+    }
+    if (accumulated + count >= target) {
+      const double position = (target - accumulated) / count;
+      return min + static_cast<int64_t>(position * (max - min));
+    }
+    accumulated += count;
+  }
+  return 0;
+}
+
+base::Value::List GetRequestHandlerStats() {
+  base::Value::List stats;
+  for (const base::HistogramBase* histogram :
+       base::StatisticsRecorder::Sort(base::StatisticsRecorder::WithName(
+           base::StatisticsRecorder::GetHistograms(),
+           kRequestHandlerHistogramPrefix))) {
+    const std::unique_ptr<base::HistogramSamples> samples =
+        histogram->SnapshotSamples();
+    if (!samples->TotalCount()) {
+      continue;
+    }
+    base::Value::Dict stage;
+    stage.Set("name", histogram->histogram_name());
+    stage.Set("count", samples->TotalCount());
+    stage.Set("p50_us",
+              static_cast<double>(EstimatePercentile(*samples, 0.5)));
+    stage.Set("p95_us",
+              static_cast<double>(EstimatePercentile(*samples, 0.95)));
+    stats.Append(std::move(stage));
+  }
+  return stats;
+}
+
+}  // namespace brave
@@ -0,0 +1,30 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_BROWSER_NET_BRAVE_REQUEST_HANDLER_STATS_H_
+#define BRAVE_BROWSER_NET_BRAVE_REQUEST_HANDLER_STATS_H_
+
+#include <cstdint>
+
+#include "base/values.h"
+
+namespace base {
+class HistogramSamples;
+}  // namespace base
+
+namespace brave {
+
+// Estimates the |fraction| percentile of |samples| by interpolating within the
+// bucket that contains it. Returns 0 if |samples| is empty.
+int64_t EstimatePercentile(const base::HistogramSamples& samples,
+                           double fraction);
+
+// Summarizes the BraveRequestHandler stage latency histograms that have
+// samples, as a list of {name, count, p50_us, p95_us} sorted by name.
+base::Value::List GetRequestHandlerStats();
+
+}  // namespace brave
+
+#endif  // BRAVE_BROWSER_NET_BRAVE_REQUEST_HANDLER_STATS_H_
@@ -0,0 +1,86 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/brave_request_handler_stats.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/metrics/histogram.h"
+#include "base/metrics/histogram_samples.h"
+#include "base/metrics/statistics_recorder.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave {
+
+namespace {
+
+// Buckets are [0, 10), [10, 20), [20, 30) and [30, INT_MAX).
+base::HistogramBase* GetTestHistogram(const std::string& name) {
+  return base::CustomHistogram::FactoryGet(
+      name, std::vector<base::HistogramBase::Sample>({10, 20, 30}),
+      base::HistogramBase::kNoFlags);
+}
+
+}  // namespace
+
+class BraveRequestHandlerStatsTest : public testing::Test {
+ protected:
+  std::unique_ptr<base::StatisticsRecorder> statistics_recorder_ =
+      base::StatisticsRecorder::CreateTemporaryForTesting();
+};
+
+TEST_F(BraveRequestHandlerStatsTest, EstimatePercentileEmpty) {
+  base::HistogramBase* histogram = GetTestHistogram("Test.Empty");
+  EXPECT_EQ(0, EstimatePercentile(*histogram->SnapshotSamples(), 0.5));
+}
+
+TEST_F(BraveRequestHandlerStatsTest, EstimatePercentileInterpolates) {
+  base::HistogramBase* histogram = GetTestHistogram("Test.Interpolate");
+  histogram->AddCount(15, 10);
+  histogram->AddCount(25, 10);
+  const std::unique_ptr<base::HistogramSamples> samples =
+      histogram->SnapshotSamples();
+
+  EXPECT_EQ(15, EstimatePercentile(*samples, 0.25));
+  EXPECT_EQ(20, EstimatePercentile(*samples, 0.5));
+  EXPECT_EQ(25, EstimatePercentile(*samples, 0.75));
+  EXPECT_EQ(29, EstimatePercentile(*samples, 0.95));
+}
+
+TEST_F(BraveRequestHandlerStatsTest, EstimatePercentileSingleBucket) {
+  base::HistogramBase* histogram = GetTestHistogram("Test.SingleBucket");
+  histogram->AddCount(5, 4);
+  const std::unique_ptr<base::HistogramSamples> samples =
+      histogram->SnapshotSamples();
+
+  EXPECT_EQ(0, EstimatePercentile(*samples, 0));
+  EXPECT_EQ(5, EstimatePercentile(*samples, 0.5));
+  EXPECT_EQ(10, EstimatePercentile(*samples, 1));
+}
+
+TEST_F(BraveRequestHandlerStatsTest, GetRequestHandlerStats) {
+  GetTestHistogram("Brave.RequestHandler.B.SyncTime")->AddCount(15, 2);
+  GetTestHistogram("Brave.RequestHandler.A.SyncTime")->AddCount(25, 4);
+  GetTestHistogram("Brave.RequestHandler.C.SyncTime");
+  GetTestHistogram("Brave.Other")->AddCount(15, 1);
+
+  const base::Value::List stats = GetRequestHandlerStats();
+  ASSERT_EQ(2u, stats.size());
+
+  const base::Value::Dict& a = stats[0].GetDict();
+  EXPECT_EQ("Brave.RequestHandler.A.SyncTime", *a.FindString("name"));
+  EXPECT_EQ(4, a.FindInt("count"));
+  EXPECT_EQ(25, a.FindDouble("p50_us"));
+  EXPECT_EQ(29, a.FindDouble("p95_us"));
+
+  const base::Value::Dict& b = stats[1].GetDict();
+  EXPECT_EQ("Brave.RequestHandler.B.SyncTime", *b.FindString("name"));
+  EXPECT_EQ(2, b.FindInt("count"));
+  EXPECT_EQ(15, b.FindDouble("p50_us"));
+}
+
+}  // namespace brave
@@ -0,0 +1,121 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/brave_request_handler.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/functional/bind.h"
+#include "brave/browser/net/url_context.h"
+#include "content/public/browser/browser_thread.h"
+#include "content/public/test/browser_task_environment.h"
+#include "net/base/net_errors.h"
+#include "net/base/test_completion_callback.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace {
+
+int RecordStage(const std::string& name,
+                std::vector<std::string>* stages,
+                std::vector<bool>* ran_on_ui,
+                const brave::ResponseCallback& next_callback,
+                std::shared_ptr<brave::BraveRequestInfo> ctx) {
+  stages->push_back(name);
+  ran_on_ui->push_back(
+      content::BrowserThread::CurrentlyOn(content::BrowserThread::UI));
+  ctx->new_url_spec = "https://" + name + ".example.com/";
+  return net::OK;
+}
+
+int FailStage(const brave::ResponseCallback& next_callback,
+              std::shared_ptr<brave::BraveRequestInfo> ctx) {
+  return net::ERR_ACCESS_DENIED;
+}
+
+}  // namespace
+
+class BraveRequestHandlerTest : public testing::Test {
+ protected:
+  std::shared_ptr<brave::BraveRequestInfo> MakeCtx() {
+    auto ctx =
+        std::make_shared<brave::BraveRequestInfo>(GURL("https://brave.com/"));
+    ctx->request_identifier = 1;
+    return ctx;
+  }
+
+  content::BrowserTaskEnvironment task_environment_;
+};
+
+TEST_F(BraveRequestHandlerTest, SiteHacksRunOnTaskRunner) {
+  BraveRequestHandler handler;
+  ASSERT_FALSE(handler.before_url_request_callbacks_.empty());
+  EXPECT_STREQ("BeforeURLRequest.SiteHacks",
+               handler.before_url_request_callbacks_[0].name);
+  EXPECT_TRUE(handler.before_url_request_callbacks_[0].run_on_task_runner);
+  for (size_t i = 1; i < handler.before_url_request_callbacks_.size(); ++i) {
+    EXPECT_FALSE(handler.before_url_request_callbacks_[i].run_on_task_runner)
+        << handler.before_url_request_callbacks_[i].name;
+  }
+}
+
+TEST_F(BraveRequestHandlerTest, StagesRunOnTaskRunnerInOrder) {
+  BraveRequestHandler handler;
+  std::vector<std::string> stages;
+  std::vector<bool> ran_on_ui;
+  handler.before_url_request_callbacks_ = {
+      {"BeforeURLRequest.Test1",
+       base::BindRepeating(&RecordStage, "first", &stages, &ran_on_ui),
+       /*run_on_task_runner=*/true},
+      {"BeforeURLRequest.Test2",
+       base::BindRepeating(&RecordStage, "second", &stages, &ran_on_ui),
+       /*run_on_task_runner=*/true},
+      {"BeforeURLRequest.Test3",
+       base::BindRepeating(&RecordStage, "third", &stages, &ran_on_ui)},
+  };
+  BraveRequestHandler::SetupStageHistograms(
+      &handler.before_url_request_callbacks_);
+
+  auto ctx = MakeCtx();
+  GURL new_url;
+  net::TestCompletionCallback callback;
+  EXPECT_EQ(net::ERR_IO_PENDING,
+            handler.OnBeforeURLRequest(ctx, callback.callback(), &new_url));
+  EXPECT_EQ(net::OK, callback.WaitForResult());
+
+  EXPECT_EQ(std::vector<std::string>({"first", "second", "third"}), stages);
+  EXPECT_EQ(std::vector<bool>({false, false, true}), ran_on_ui);
+  EXPECT_EQ(3u, ctx->next_url_request_index);
+  EXPECT_EQ(GURL("https://third.example.com/"), new_url);
+}
+
+TEST_F(BraveRequestHandlerTest, StageOnTaskRunnerStopsChainOnError) {
+  BraveRequestHandler handler;
+  std::vector<std::string> stages;
+  std::vector<bool> ran_on_ui;
+  handler.before_url_request_callbacks_ = {
+      {"BeforeURLRequest.Test1", base::BindRepeating(&FailStage),
+       /*run_on_task_runner=*/true},
+      {"BeforeURLRequest.Test2",
+       base::BindRepeating(&RecordStage, "second", &stages, &ran_on_ui),
+       /*run_on_task_runner=*/true},
+      {"BeforeURLRequest.Test3",
+       base::BindRepeating(&RecordStage, "third", &stages, &ran_on_ui)},
+  };
+  BraveRequestHandler::SetupStageHistograms(
+      &handler.before_url_request_callbacks_);
+
+  auto ctx = MakeCtx();
+  GURL new_url;
+  net::TestCompletionCallback callback;
+  EXPECT_EQ(net::ERR_IO_PENDING,
+            handler.OnBeforeURLRequest(ctx, callback.callback(), &new_url));
+  EXPECT_EQ(net::ERR_ACCESS_DENIED, callback.WaitForResult());
+
+  EXPECT_TRUE(stages.empty());
+  EXPECT_TRUE(new_url.is_empty());
+}
@@ -10,6 +10,7 @@
 #include <set>
 #include <string>
 
+#include "base/time/time.h"
 #include "net/base/network_anonymization_key.h"
 #include "net/http/http_request_headers.h"
 #include "net/http/http_response_headers.h"
@@ -136,6 +137,10 @@ struct BraveRequestInfo {
   friend class ::BraveRequestHandler;
 
   GURL* new_url = nullptr;
+  // Set while a handler stage is pending, to measure its asynchronous time and
+  // to close its trace event if the request goes away first.
+  const char* pending_stage_name = nullptr;
+  base::TimeTicks pending_stage_start_time;
 };
 
 // ResponseListener
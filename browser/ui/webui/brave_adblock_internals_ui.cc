@@ -14,6 +14,7 @@
 #include "base/strings/string_number_conversions.h"
 #include "base/values.h"
 #include "brave/browser/brave_browser_process.h"
+#include "brave/browser/net/brave_request_handler_stats.h"
 #include "brave/browser/ui/webui/brave_webui_source.h"
 #include "brave/components/brave_adblock/adblock_internals/resources/grit/brave_adblock_internals_generated_map.h"
 #include "brave/components/brave_shields/browser/ad_block_service.h"
@@ -120,6 +121,7 @@ class BraveAdblockInternalsMessageHandler
     result.Set("default_engine", std::move(default_engine_info));
     result.Set("additional_engine", std::move(additional_engine_info));
     result.Set("memory", std::move(mem_info));
+    result.Set("request_handler", brave::GetRequestHandlerStats());
     ResolveJavascriptCallback(base::Value(callback_id), result);
   }
 
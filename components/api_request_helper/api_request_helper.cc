@@ -7,7 +7,10 @@
 
 #include <utility>
 
+#include "base/json/json_reader.h"
 #include "base/json/json_writer.h"
+#include "base/task/thread_pool.h"
+#include "brave/components/json/rs/src/lib.rs.h"
 #include "net/base/load_flags.h"
 #include "net/http/http_status_code.h"
 #include "services/data_decoder/public/cpp/data_decoder.h"
@@ -20,7 +23,24 @@ namespace api_request_helper {
 
 namespace {
 
-void OnParseJsonIsolated(
+// Runs on a thread pool task. The untrusted response is only parsed by the
+// Rust JSON parser, base::JSONReader then parses its well-formed output.
+data_decoder::DataDecoder::ValueOrError ParseJsonInProcess(std::string json) {
+  const std::string sanitized_json(json::sanitize_json(
+      rust::Slice<const uint8_t>(reinterpret_cast<const uint8_t*>(json.data()),
+                                 json.size())));
+  if (sanitized_json.empty()) {
+    return base::unexpected("Invalid JSON");
+  }
+  auto value = base::JSONReader::ReadAndReturnValueWithError(
+      sanitized_json, base::JSON_PARSE_RFC);
+  if (!value.has_value()) {
+    return base::unexpected(value.error().message);
+  }
+  return std::move(*value);
+}
+
+void OnParseJson(
     int http_code,
     const base::flat_map<std::string, std::string>& headers,
     int error_code,
@@ -147,12 +167,14 @@ APIRequestHelper::Ticket APIRequestHelper::Request(
         url_loader_factory_.get(),
         base::BindOnce(&APIRequestHelper::OnResponse,
                        weak_ptr_factory_.GetWeakPtr(), iter,
+                       request_options.parse_json_in_process,
                        std::move(callback), std::move(conversion_callback)));
   } else {
     iter->get()->DownloadToString(
         url_loader_factory_.get(),
         base::BindOnce(&APIRequestHelper::OnResponse,
                        weak_ptr_factory_.GetWeakPtr(), iter,
+                       request_options.parse_json_in_process,
                        std::move(callback), std::move(conversion_callback)),
         request_options.max_body_size);
   }
@@ -223,6 +245,7 @@ std::unique_ptr<network::SimpleURLLoader> APIRequestHelper::CreateLoader(
 
 void APIRequestHelper::OnResponse(
     SimpleURLLoaderList::iterator iter,
+    bool parse_json_in_process,
     ResultCallback callback,
     ResponseConversionCallback conversion_callback,
     const std::unique_ptr<std::string> response_body) {
@@ -263,10 +286,20 @@ void APIRequestHelper::OnResponse(
     raw_body = converted_body.value();
   }
 
-  data_decoder::DataDecoder::ParseJsonIsolated(
-      raw_body,
-      base::BindOnce(&OnParseJsonIsolated, response_code, std::move(headers),
-                     error_code, final_url, std::move(callback)));
+  auto on_parse_json =
+      base::BindOnce(&OnParseJson, response_code, std::move(headers),
+                     error_code, final_url, std::move(callback));
+  if (parse_json_in_process && raw_body.size() <= kMaxInProcessJsonSize) {
+    base::ThreadPool::PostTaskAndReplyWithResult(
+        FROM_HERE,
+        {base::TaskPriority::USER_VISIBLE,
+         base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
+        base::BindOnce(&ParseJsonInProcess, std::move(raw_body)),
+        std::move(on_parse_json));
+    return;
+  }
+  data_decoder::DataDecoder::ParseJsonIsolated(raw_body,
+                                               std::move(on_parse_json));
 }
 
 void APIRequestHelper::OnDownload(SimpleURLLoaderList::iterator iter,
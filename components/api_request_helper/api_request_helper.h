@@ -77,8 +77,19 @@ struct APIRequestOptions {
   bool auto_retry_on_network_change = false;
   size_t max_body_size = -1u;
   absl::optional<base::TimeDelta> timeout;
+  // Validates the response with a memory-safe parser on a thread pool task
+  // instead of the data decoder utility process. That parser is stricter than
+  // the utility process: it rejects trailing commas, invalid UTF-8 (rather
+  // than replacing it with U+FFFD) and nesting deeper than 128 levels.
+  // Responses larger than kMaxInProcessJsonSize (1 MiB) are still parsed in
+  // the utility process, so they get its more lenient behavior.
+  bool parse_json_in_process = false;
 };
 
+// Largest response body parsed in-process when
+// APIRequestOptions::parse_json_in_process is set.
+inline constexpr size_t kMaxInProcessJsonSize = 1024 * 1024;
+
 // Anyone is welcome to use APIRequestHelper to reduce boilerplate
 class APIRequestHelper {
  public:
@@ -149,6 +160,7 @@ class APIRequestHelper {
   using SimpleURLLoaderList =
       std::list<std::unique_ptr<network::SimpleURLLoader>>;
   void OnResponse(SimpleURLLoaderList::iterator iter,
+                  bool parse_json_in_process,
                   ResultCallback callback,
                   ResponseConversionCallback conversion_callback,
                   const std::unique_ptr<std::string> response_body);
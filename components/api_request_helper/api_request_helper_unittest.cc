@@ -6,6 +6,7 @@
 #include "brave/components/api_request_helper/api_request_helper.h"
 
 #include <memory>
+#include <string>
 #include <utility>
 
 #include "base/functional/callback.h"
@@ -14,6 +15,7 @@
 #include "base/test/task_environment.h"
 #include "base/test/values_test_util.h"
 #include "base/values.h"
+#include "build/build_config.h"
 #include "net/traffic_annotation/network_traffic_annotation.h"
 #include "net/traffic_annotation/network_traffic_annotation_test_helper.h"
 #include "services/data_decoder/public/cpp/test_support/in_process_data_decoder.h"
@@ -101,11 +103,31 @@ class ApiRequestHelperUnitTest : public testing::Test {
     base::RunLoop().RunUntilIdle();
   }
 
+  void SendRequestParsedInProcess(const std::string& server_raw_response,
+                                  const std::string& expected_body,
+                                  const base::Value& expected_value_body) {
+    GURL network_url("http://localhost/");
+
+    APIRequestResult expected_result(200, expected_body,
+                                     expected_value_body.Clone(),
+                                     {{"content-type", "text/html"}}, net::OK,
+                                     network_url);
+    base::MockCallback<APIRequestHelper::ResultCallback> callback;
+    EXPECT_CALL(callback, Run(MatchesAPIRequestResult(&expected_result)));
+
+    SetInterceptor("POST", network_url, server_raw_response);
+    APIRequestOptions request_options;
+    request_options.parse_json_in_process = true;
+    api_request_helper_->Request("POST", network_url, "", "application/json",
+                                 callback.Get(), request_options);
+    task_environment_.RunUntilIdle();
+  }
+
  protected:
+  base::test::TaskEnvironment task_environment_;
   std::unique_ptr<APIRequestHelper> api_request_helper_;
 
  private:
-  base::test::TaskEnvironment task_environment_;
   network::TestURLLoaderFactory url_loader_factory_;
   scoped_refptr<network::SharedURLLoaderFactory> shared_url_loader_factory_;
   data_decoder::test::InProcessDataDecoder in_process_data_decoder_;
@@ -129,6 +151,53 @@ TEST_F(ApiRequestHelperUnitTest, SanitizedRequest) {
 #endif
 }
 
+TEST_F(ApiRequestHelperUnitTest, SanitizedRequestParsedInProcess) {
+  std::string expected_sanitized_response =
+      "{\"id\":1,\"jsonrpc\":\"2.0\",\"result\":1.8446744073709552e+19}";
+  std::string server_raw_response =
+      "{\"id\":1,\"jsonrpc\":\"2.0\",\"result\":18446744073709551615}";
+  SendRequestParsedInProcess(server_raw_response, expected_sanitized_response,
+                             ParseJson(expected_sanitized_response));
+  SendRequestParsedInProcess("", "", base::Value());
+  SendRequestParsedInProcess("{}", "{}", base::Value(base::Value::Type::DICT));
+  SendRequestParsedInProcess("{", "", base::Value());
+  SendRequestParsedInProcess("0", "", base::Value());
+  SendRequestParsedInProcess("a", "", base::Value());
+  // The in-process parser is strict and doesn't support trailing commas.
+  SendRequestParsedInProcess("{\"a\":1,}", "", base::Value());
+  SendRequestParsedInProcess(std::string(200, '[') + std::string(200, ']'), "",
+                             base::Value());
+}
+
+// Android's sanitizer is as strict as the in-process parser.
+#if !BUILDFLAG(IS_ANDROID)
+TEST_F(ApiRequestHelperUnitTest, InProcessParserRejectsTrailingCommas) {
+  SendRequest("{\"a\":1,}", "{\"a\":1}", ParseJson("{\"a\":1}"));
+  SendRequestParsedInProcess("{\"a\":1,}", "", base::Value());
+}
+
+TEST_F(ApiRequestHelperUnitTest, InProcessParserRejectsInvalidUTF8) {
+  // The utility process replaces invalid characters with U+FFFD.
+  SendRequest("{\"a\":\"\xff\"}", "{\"a\":\"\xef\xbf\xbd\"}",
+              ParseJson("{\"a\":\"\xef\xbf\xbd\"}"));
+  SendRequestParsedInProcess("{\"a\":\"\xff\"}", "", base::Value());
+}
+
+TEST_F(ApiRequestHelperUnitTest, InProcessParserRejectsDeepNesting) {
+  const std::string json = std::string(150, '[') + std::string(150, ']');
+  SendRequest(json, json, ParseJson(json));
+  SendRequestParsedInProcess(json, "", base::Value());
+}
+
+TEST_F(ApiRequestHelperUnitTest, LargeResponsesAreParsedInUtilityProcess) {
+  // Trailing commas are only accepted by the utility process.
+  const std::string value(kMaxInProcessJsonSize, 'a');
+  const std::string expected_json = "{\"a\":\"" + value + "\"}";
+  SendRequestParsedInProcess("{\"a\":\"" + value + "\",}", expected_json,
+                             ParseJson(expected_json));
+}
+#endif  // !BUILDFLAG(IS_ANDROID)
+
 TEST_F(ApiRequestHelperUnitTest, RequestWithConversion) {
   std::string expected_sanitized_response =
       "{\"id\":1,\"jsonrpc\":\"2.0\",\"result\":\"18446744073709551615\"}";
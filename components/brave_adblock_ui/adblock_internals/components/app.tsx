@@ -8,11 +8,13 @@ import { sendWithPromise } from 'chrome://resources/js/cr.js'
 import { MemoryInfo } from './memory_info'
 import { Engine, EngineDebugInfo } from './engine'
 import { discardRegexs, saveRegexTexts } from './regex'
+import { RequestHandlerStageStats, RequestHandlerStats } from './request_handler_stats'
 
 class AppState {
   default_engine = new EngineDebugInfo()
   additional_engine = new EngineDebugInfo()
   memory: { [key: string]: string } = {}
+  request_handler: RequestHandlerStageStats[] = []
 }
 
 export class App extends React.Component<{}, AppState> {
@@ -43,6 +45,7 @@ export class App extends React.Component<{}, AppState> {
     return (
       <div>
         <MemoryInfo key="memory" caption="Browser process memory" memory={this.state.memory} />
+        <RequestHandlerStats key="request_handler" caption="Request handler stage latency" stats={this.state.request_handler} />
         <input type="button" value="Discard All Regex" onClick={() => { this.discardAll() }} />
         <Engine key="default_engine" caption="Default engine" info={this.state.default_engine} />
         <Engine key="additional_engine" caption="Additional engine" info={this.state.additional_engine} />
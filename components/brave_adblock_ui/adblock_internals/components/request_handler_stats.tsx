@@ -0,0 +1,45 @@
+// Copyright (c) 2023 The Brave Authors. All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this file,
+// you can obtain one at https://mozilla.org/MPL/2.0/.
+
+import * as React from 'react'
+
+export class RequestHandlerStageStats {
+  name: string = ''
+  count: number = 0
+  p50_us: number = 0
+  p95_us: number = 0
+}
+
+interface Props {
+  caption: string
+  stats: RequestHandlerStageStats[]
+}
+
+export class RequestHandlerStats extends React.Component<Props, {}> {
+  render () {
+    const items = this.props.stats.map(s => (
+      <tr key={s.name}>
+        <td>{s.name}</td>
+        <td>{s.count}</td>
+        <td>{s.p50_us}</td>
+        <td>{s.p95_us}</td>
+      </tr>))
+
+    return (
+      <table>
+        <caption><h2>{this.props.caption}</h2></caption>
+        <tbody>
+          <tr>
+            <th>Histogram</th>
+            <th>Count</th>
+            <th>p50 (us)</th>
+            <th>p95 (us)</th>
+          </tr>
+          {items}
+        </tbody>
+      </table>
+    )
+  }
+}
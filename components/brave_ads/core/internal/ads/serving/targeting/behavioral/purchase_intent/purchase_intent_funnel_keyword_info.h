@@ -8,6 +8,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace brave_ads::targeting {
 
@@ -16,6 +17,8 @@ struct PurchaseIntentFunnelKeywordInfo final {
   PurchaseIntentFunnelKeywordInfo(std::string keywords, uint16_t weight);
 
   std::string keywords;
+  // |keywords| tokenized and sorted when the resource is loaded.
+  std::vector<std::string> sorted_keywords;
   uint16_t weight = 0;
 };
 
@@ -164,6 +164,8 @@ void AdsImpl::Shutdown(ShutdownCallback callback) {
 
   NotificationAdManager::GetInstance()->RemoveAll();
 
+  ClientStateManager::GetInstance()->SaveIfNeeded();
+
   std::move(callback).Run(/*success*/ true);
 }
 
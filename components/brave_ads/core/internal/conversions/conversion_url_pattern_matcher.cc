@@ -0,0 +1,133 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/conversions/conversion_url_pattern_matcher.h"
+
+#include <utility>
+
+#include "base/check.h"
+#include "base/containers/contains.h"
+#include "brave/components/brave_ads/core/internal/common/url/url_util.h"
+#include "third_party/re2/src/re2/re2.h"
+#include "url/gurl.h"
+
+namespace brave_ads {
+
+namespace {
+
+// Converts a |base::MatchPattern| wildcard pattern, where '*' matches zero or
+// more characters and '?' matches zero or one character, to a regular
+// expression.
+std::string UrlPatternToRegex(const std::string& url_pattern) {
+  std::string regex;
+  for (const char c : url_pattern) {
+    if (c == '*') {
+      regex.append(".*");
+    } else if (c == '?') {
+      regex.append(".?");
+    } else {
+      regex.append(RE2::QuoteMeta(re2::StringPiece(&c, 1)));
+    }
+  }
+
+  return regex;
+}
+
+RE2::Options GetRegexOptions() {
+  RE2::Options options;
+  options.set_dot_nl(true);
+  options.set_log_errors(false);
+  return options;
+}
+
+}  // namespace
+
+ConversionUrlPatternMatcher::ConversionUrlPatternMatcher(
+    std::set<std::string> url_patterns)
+    : ConversionUrlPatternMatcher(std::move(url_patterns),
+                                  RE2::Options().max_mem()) {}
+
+ConversionUrlPatternMatcher::ConversionUrlPatternMatcher(
+    std::set<std::string> url_patterns,
+    const int64_t max_mem)
+    : url_patterns_(std::move(url_patterns)) {
+  RE2::Options options = GetRegexOptions();
+  options.set_max_mem(max_mem);
+
+  url_pattern_set_ = std::make_unique<RE2::Set>(options, RE2::ANCHOR_BOTH);
+
+  for (const auto& url_pattern : url_patterns_) {
+    if (url_pattern.empty()) {
+      // Empty url patterns never match, see |MatchUrlPattern|.
+      continue;
+    }
+
+    // Escaped wildcards are rare, so leave them to |MatchUrlPattern| rather than
+    // replicating its escaping rules.
+    if (base::Contains(url_pattern, '\\') ||
+        url_pattern_set_->Add(UrlPatternToRegex(url_pattern),
+                              /*error*/ nullptr) == -1) {
+      uncompiled_url_patterns_.push_back(url_pattern);
+      continue;
+    }
+
+    compiled_url_patterns_.push_back(url_pattern);
+  }
+
+  if (compiled_url_patterns_.empty() || !url_pattern_set_->Compile()) {
+    uncompiled_url_patterns_.insert(uncompiled_url_patterns_.cend(),
+                                    compiled_url_patterns_.cbegin(),
+                                    compiled_url_patterns_.cend());
+    compiled_url_patterns_.clear();
+    url_pattern_set_.reset();
+  }
+}
+
+ConversionUrlPatternMatcher::~ConversionUrlPatternMatcher() = default;
+
+std::set<std::string> ConversionUrlPatternMatcher::GetMatchingUrlPatterns(
+    const std::vector<GURL>& redirect_chain) const {
+  std::set<std::string> matching_url_patterns;
+
+  std::vector<int> indexes;
+  for (const auto& url : redirect_chain) {
+    if (!url.is_valid()) {
+      continue;
+    }
+
+    if (url_pattern_set_) {
+      RE2::Set::ErrorInfo error_info{RE2::Set::kNoError};
+      if (url_pattern_set_->Match(url.spec(), &indexes, &error_info)) {
+        for (const int index : indexes) {
+          matching_url_patterns.insert(compiled_url_patterns_.at(index));
+        }
+      } else if (error_info.kind == RE2::Set::kOutOfMemory) {
+        MatchCompiledUrlPatternsIndividually(url, &matching_url_patterns);
+      }
+    }
+
+    for (const auto& url_pattern : uncompiled_url_patterns_) {
+      if (MatchUrlPattern(url, url_pattern)) {
+        matching_url_patterns.insert(url_pattern);
+      }
+    }
+  }
+
+  return matching_url_patterns;
+}
+
+void ConversionUrlPatternMatcher::MatchCompiledUrlPatternsIndividually(
+    const GURL& url,
+    std::set<std::string>* matching_url_patterns) const {
+  DCHECK(matching_url_patterns);
+
+  for (const auto& url_pattern : compiled_url_patterns_) {
+    if (MatchUrlPattern(url, url_pattern)) {
+      matching_url_patterns->insert(url_pattern);
+    }
+  }
+}
+
+}  // namespace brave_ads
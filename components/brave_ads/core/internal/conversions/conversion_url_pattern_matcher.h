@@ -0,0 +1,75 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CONVERSIONS_CONVERSION_URL_PATTERN_MATCHER_H_
+#define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CONVERSIONS_CONVERSION_URL_PATTERN_MATCHER_H_
+
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "base/gtest_prod_util.h"
+#include "third_party/re2/src/re2/set.h"
+
+class GURL;
+
+namespace brave_ads {
+
+// Compiles a set of conversion url patterns, which use the same wildcard syntax
+// as |MatchUrlPattern|, into a single regular expression set so that each url
+// is only scanned once regardless of the number of patterns.
+class ConversionUrlPatternMatcher final {
+ public:
+  explicit ConversionUrlPatternMatcher(std::set<std::string> url_patterns);
+  // |max_mem| bounds the memory used by the compiled regular expression set,
+  // see |RE2::Options::max_mem|.
+  ConversionUrlPatternMatcher(std::set<std::string> url_patterns,
+                              int64_t max_mem);
+
+  ConversionUrlPatternMatcher(const ConversionUrlPatternMatcher& other) =
+      delete;
+  ConversionUrlPatternMatcher& operator=(
+      const ConversionUrlPatternMatcher& other) = delete;
+
+  ConversionUrlPatternMatcher(ConversionUrlPatternMatcher&& other) noexcept =
+      delete;
+  ConversionUrlPatternMatcher& operator=(
+      ConversionUrlPatternMatcher&& other) noexcept = delete;
+
+  ~ConversionUrlPatternMatcher();
+
+  const std::set<std::string>& url_patterns() const { return url_patterns_; }
+
+  // Returns the url patterns which match at least one url in |redirect_chain|.
+  std::set<std::string> GetMatchingUrlPatterns(
+      const std::vector<GURL>& redirect_chain) const;
+
+ private:
+  FRIEND_TEST_ALL_PREFIXES(BatAdsConversionUrlPatternMatcherTest,
+                           GetMatchingUrlPatternsWhenCompileRunsOutOfMemory);
+  FRIEND_TEST_ALL_PREFIXES(BatAdsConversionUrlPatternMatcherTest,
+                           MatchCompiledUrlPatternsIndividually);
+
+  // Matches |url| against each of |compiled_url_patterns_| using
+  // |MatchUrlPattern|, for when |url_pattern_set_| runs out of memory.
+  void MatchCompiledUrlPatternsIndividually(
+      const GURL& url,
+      std::set<std::string>* matching_url_patterns) const;
+
+  std::set<std::string> url_patterns_;
+
+  // Url patterns indexed by their position in |url_pattern_set_|.
+  std::vector<std::string> compiled_url_patterns_;
+  std::unique_ptr<re2::RE2::Set> url_pattern_set_;
+
+  // Url patterns which could not be compiled are matched individually.
+  std::vector<std::string> uncompiled_url_patterns_;
+};
+
+}  // namespace brave_ads
+
+#endif  // BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CONVERSIONS_CONVERSION_URL_PATTERN_MATCHER_H_
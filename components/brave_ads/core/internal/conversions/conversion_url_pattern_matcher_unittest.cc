@@ -0,0 +1,140 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/conversions/conversion_url_pattern_matcher.h"
+
+#include <set>
+#include <string>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+// npm run test -- brave_unit_tests --filter=BatAds*
+
+namespace brave_ads {
+
+TEST(BatAdsConversionUrlPatternMatcherTest, GetMatchingUrlPatterns) {
+  // Arrange
+  const ConversionUrlPatternMatcher matcher(
+      {"https://www.foo.com/*", "https://www.bar.com/*/thanks",
+       "https://www.baz.com/checkout?"});
+
+  // Act
+  const std::set<std::string> matching_url_patterns =
+      matcher.GetMatchingUrlPatterns(
+          {GURL("https://www.foo.com/signup"),
+           GURL("https://www.bar.com/checkout/thanks"),
+           GURL("https://www.qux.com/")});
+
+  // Assert
+  const std::set<std::string> expected_matching_url_patterns = {
+      "https://www.foo.com/*", "https://www.bar.com/*/thanks"};
+  EXPECT_EQ(expected_matching_url_patterns, matching_url_patterns);
+}
+
+TEST(BatAdsConversionUrlPatternMatcherTest,
+     GetMatchingUrlPatternsWhenCompileRunsOutOfMemory) {
+  // Arrange
+  const ConversionUrlPatternMatcher matcher(
+      {"https://www.foo.com/*", "https://www.bar.com/*/thanks",
+       "https://www.baz.com/checkout?"},
+      /*max_mem*/ 1024);
+  ASSERT_FALSE(matcher.url_pattern_set_);
+
+  // Act
+  const std::set<std::string> matching_url_patterns =
+      matcher.GetMatchingUrlPatterns(
+          {GURL("https://www.foo.com/signup"),
+           GURL("https://www.bar.com/checkout/thanks"),
+           GURL("https://www.qux.com/")});
+
+  // Assert
+  const std::set<std::string> expected_matching_url_patterns = {
+      "https://www.foo.com/*", "https://www.bar.com/*/thanks"};
+  EXPECT_EQ(expected_matching_url_patterns, matching_url_patterns);
+}
+
+TEST(BatAdsConversionUrlPatternMatcherTest,
+     MatchCompiledUrlPatternsIndividually) {
+  // RE2 reserves the memory its DFA needs when the set is compiled, so a set
+  // which compiles cannot be made to run out of memory while matching. Call
+  // the fallback directly instead.
+
+  // Arrange
+  const ConversionUrlPatternMatcher matcher(
+      {"https://www.foo.com/*", "https://www.bar.com/*/thanks",
+       "https://www.baz.com/checkout?"});
+  ASSERT_TRUE(matcher.url_pattern_set_);
+  ASSERT_EQ(3U, matcher.compiled_url_patterns_.size());
+
+  // Act
+  std::set<std::string> matching_url_patterns;
+  for (const auto& url : {GURL("https://www.foo.com/signup"),
+                          GURL("https://www.bar.com/checkout/thanks"),
+                          GURL("https://www.qux.com/")}) {
+    matcher.MatchCompiledUrlPatternsIndividually(url, &matching_url_patterns);
+  }
+
+  // Assert
+  const std::set<std::string> expected_matching_url_patterns = {
+      "https://www.foo.com/*", "https://www.bar.com/*/thanks"};
+  EXPECT_EQ(expected_matching_url_patterns, matching_url_patterns);
+}
+
+TEST(BatAdsConversionUrlPatternMatcherTest, MatchUrlPatternWithRegexChars) {
+  // Arrange
+  const ConversionUrlPatternMatcher matcher({"https://www.foo.com/a+b(c)/*"});
+
+  // Act
+  const std::set<std::string> matching_url_patterns =
+      matcher.GetMatchingUrlPatterns(
+          {GURL("https://www.foo.com/a+b(c)/thanks")});
+
+  // Assert
+  const std::set<std::string> expected_matching_url_patterns = {
+      "https://www.foo.com/a+b(c)/*"};
+  EXPECT_EQ(expected_matching_url_patterns, matching_url_patterns);
+}
+
+TEST(BatAdsConversionUrlPatternMatcherTest, MatchEscapedUrlPattern) {
+  // Arrange
+  const ConversionUrlPatternMatcher matcher({R"(https://www.foo.com/\*)"});
+
+  // Act
+  const std::set<std::string> matching_url_patterns =
+      matcher.GetMatchingUrlPatterns(
+          {GURL("https://www.foo.com/*"), GURL("https://www.foo.com/bar")});
+
+  // Assert
+  const std::set<std::string> expected_matching_url_patterns = {
+      R"(https://www.foo.com/\*)"};
+  EXPECT_EQ(expected_matching_url_patterns, matching_url_patterns);
+}
+
+TEST(BatAdsConversionUrlPatternMatcherTest, DoNotMatchEmptyUrlPattern) {
+  // Arrange
+  const ConversionUrlPatternMatcher matcher({""});
+
+  // Act
+  const std::set<std::string> matching_url_patterns =
+      matcher.GetMatchingUrlPatterns({GURL("https://www.foo.com/")});
+
+  // Assert
+  EXPECT_TRUE(matching_url_patterns.empty());
+}
+
+TEST(BatAdsConversionUrlPatternMatcherTest, DoNotMatchInvalidUrl) {
+  // Arrange
+  const ConversionUrlPatternMatcher matcher({"*"});
+
+  // Act
+  const std::set<std::string> matching_url_patterns =
+      matcher.GetMatchingUrlPatterns({GURL("INVALID")});
+
+  // Assert
+  EXPECT_TRUE(matching_url_patterns.empty());
+}
+
+}  // namespace brave_ads
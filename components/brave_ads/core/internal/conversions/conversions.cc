@@ -5,10 +5,13 @@
 
 #include "brave/components/brave_ads/core/internal/conversions/conversions.h"
 
+#include <cstddef>
+#include <map>
 #include <set>
 #include <utility>
 
 #include "base/check.h"
+#include "base/containers/contains.h"
 #include "base/functional/bind.h"
 #include "base/notreached.h"
 #include "base/ranges/algorithm.h"
@@ -21,6 +24,7 @@
 #include "brave/components/brave_ads/core/internal/common/time/time_formatting_util.h"
 #include "brave/components/brave_ads/core/internal/common/url/url_util.h"
 #include "brave/components/brave_ads/core/internal/conversions/conversion_queue_database_table.h"
+#include "brave/components/brave_ads/core/internal/conversions/conversion_url_pattern_matcher.h"
 #include "brave/components/brave_ads/core/internal/conversions/conversions_database_table.h"
 #include "brave/components/brave_ads/core/internal/conversions/conversions_features.h"
 #include "brave/components/brave_ads/core/internal/conversions/sorts/conversions_sort_factory.h"
@@ -45,6 +49,7 @@ constexpr int64_t kDebugConvertAfterSeconds =
 constexpr int64_t kExpiredConvertAfterSeconds =
     1 * base::Time::kSecondsPerMinute;
 constexpr char kSearchInUrl[] = "url";
+constexpr size_t kMaximumConversionIdRegexes = 100;
 
 bool HasObservationWindowForAdEventExpired(const int observation_window,
                                            const AdEventInfo& ad_event) {
@@ -92,42 +97,6 @@ bool DoesConfirmationTypeMatchConversionType(
   return false;
 }
 
-std::string ExtractConversionIdFromText(
-    const std::string& html,
-    const std::vector<GURL>& redirect_chain,
-    const std::string& conversion_url_pattern,
-    const ConversionIdPatternMap& conversion_id_patterns) {
-  std::string conversion_id;
-  std::string conversion_id_pattern = features::GetConversionIdPattern();
-  std::string text = html;
-
-  const auto iter = conversion_id_patterns.find(conversion_url_pattern);
-  if (iter != conversion_id_patterns.cend()) {
-    const ConversionIdPatternInfo conversion_id_pattern_info = iter->second;
-    if (conversion_id_pattern_info.search_in == kSearchInUrl) {
-      const auto url_iter = base::ranges::find_if(
-          redirect_chain, [&conversion_url_pattern](const GURL& url) {
-            return MatchUrlPattern(url, conversion_url_pattern);
-          });
-
-      if (url_iter == redirect_chain.cend()) {
-        return conversion_id;
-      }
-
-      const GURL& url = *url_iter;
-      text = url.spec();
-    }
-
-    conversion_id_pattern = conversion_id_pattern_info.id_pattern;
-  }
-
-  re2::StringPiece text_string_piece(text);
-  const RE2 r(conversion_id_pattern);
-  RE2::FindAndConsume(&text_string_piece, r, &conversion_id);
-
-  return conversion_id;
-}
-
 std::set<std::string> GetConvertedCreativeSets(const AdEventList& ad_events) {
   std::set<std::string> creative_set_ids;
   for (const auto& ad_event : ad_events) {
@@ -146,6 +115,16 @@ std::set<std::string> GetConvertedCreativeSets(const AdEventList& ad_events) {
   return creative_set_ids;
 }
 
+std::map<std::string, AdEventList> GroupAdEventsByCreativeSetId(
+    const AdEventList& ad_events) {
+  std::map<std::string, AdEventList> grouped_ad_events;
+  for (const auto& ad_event : ad_events) {
+    grouped_ad_events[ad_event.creative_set_id].push_back(ad_event);
+  }
+
+  return grouped_ad_events;
+}
+
 AdEventList FilterAdEventsForConversion(const AdEventList& ad_events,
                                         const ConversionInfo& conversion) {
   AdEventList filtered_ad_events;
@@ -177,24 +156,6 @@ AdEventList FilterAdEventsForConversion(const AdEventList& ad_events,
   return filtered_ad_events;
 }
 
-ConversionList FilterConversions(const std::vector<GURL>& redirect_chain,
-                                 const ConversionList& conversions) {
-  ConversionList filtered_conversions;
-
-  base::ranges::copy_if(conversions, std::back_inserter(filtered_conversions),
-                        [&redirect_chain](const ConversionInfo& conversion) {
-                          const auto iter = base::ranges::find_if(
-                              redirect_chain, [&conversion](const GURL& url) {
-                                return MatchUrlPattern(url,
-                                                       conversion.url_pattern);
-                              });
-
-                          return iter != redirect_chain.cend();
-                        });
-
-  return filtered_conversions;
-}
-
 ConversionList SortConversions(const ConversionList& conversions) {
   const auto sort =
       ConversionsSortFactory::Build(ConversionSortType::kDescendingOrder);
@@ -328,12 +289,20 @@ void Conversions::OnGetAllConversions(
   // Create list of creative set ids for already converted ads
   std::set<std::string> creative_set_ids = GetConvertedCreativeSets(ad_events);
 
+  const std::map<std::string, AdEventList> grouped_ad_events =
+      GroupAdEventsByCreativeSetId(ad_events);
+
   bool converted = false;
 
   // Check for conversions
   for (const auto& conversion : filtered_conversions) {
+    const auto iter = grouped_ad_events.find(conversion.creative_set_id);
+    if (iter == grouped_ad_events.cend()) {
+      continue;
+    }
+
     const AdEventList filtered_ad_events =
-        FilterAdEventsForConversion(ad_events, conversion);
+        FilterAdEventsForConversion(iter->second, conversion);
 
     for (const auto& ad_event : filtered_ad_events) {
       if (creative_set_ids.find(conversion.creative_set_id) !=
@@ -345,7 +314,7 @@ void Conversions::OnGetAllConversions(
       creative_set_ids.insert(ad_event.creative_set_id);
 
       VerifiableConversionInfo verifiable_conversion;
-      verifiable_conversion.id = ExtractConversionIdFromText(
+      verifiable_conversion.id = ExtractConversionId(
           html, redirect_chain, conversion.url_pattern, conversion_id_patterns);
       verifiable_conversion.public_key = conversion.advertiser_public_key;
 
@@ -362,6 +331,85 @@ void Conversions::OnGetAllConversions(
   }
 }
 
+ConversionList Conversions::FilterConversions(
+    const std::vector<GURL>& redirect_chain,
+    const ConversionList& conversions) {
+  std::set<std::string> url_patterns;
+  for (const auto& conversion : conversions) {
+    url_patterns.insert(conversion.url_pattern);
+  }
+
+  if (!url_pattern_matcher_ ||
+      url_pattern_matcher_->url_patterns() != url_patterns) {
+    url_pattern_matcher_ =
+        std::make_unique<ConversionUrlPatternMatcher>(std::move(url_patterns));
+  }
+
+  const std::set<std::string> matching_url_patterns =
+      url_pattern_matcher_->GetMatchingUrlPatterns(redirect_chain);
+
+  ConversionList filtered_conversions;
+
+  base::ranges::copy_if(
+      conversions, std::back_inserter(filtered_conversions),
+      [&matching_url_patterns](const ConversionInfo& conversion) {
+        return base::Contains(matching_url_patterns, conversion.url_pattern);
+      });
+
+  return filtered_conversions;
+}
+
+std::string Conversions::ExtractConversionId(
+    const std::string& html,
+    const std::vector<GURL>& redirect_chain,
+    const std::string& conversion_url_pattern,
+    const ConversionIdPatternMap& conversion_id_patterns) {
+  std::string conversion_id;
+  std::string conversion_id_pattern = features::GetConversionIdPattern();
+  re2::StringPiece text_string_piece(html);
+
+  const auto iter = conversion_id_patterns.find(conversion_url_pattern);
+  if (iter != conversion_id_patterns.cend()) {
+    const ConversionIdPatternInfo& conversion_id_pattern_info = iter->second;
+    if (conversion_id_pattern_info.search_in == kSearchInUrl) {
+      const auto url_iter = base::ranges::find_if(
+          redirect_chain, [&conversion_url_pattern](const GURL& url) {
+            return MatchUrlPattern(url, conversion_url_pattern);
+          });
+
+      if (url_iter == redirect_chain.cend()) {
+        return conversion_id;
+      }
+
+      text_string_piece = url_iter->possibly_invalid_spec();
+    }
+
+    conversion_id_pattern = conversion_id_pattern_info.id_pattern;
+  }
+
+  RE2::FindAndConsume(&text_string_piece,
+                      GetConversionIdRegex(conversion_id_pattern),
+                      &conversion_id);
+
+  return conversion_id;
+}
+
+const RE2& Conversions::GetConversionIdRegex(const std::string& pattern) {
+  auto iter = conversion_id_regexes_.find(pattern);
+  if (iter != conversion_id_regexes_.cend()) {
+    return *iter->second;
+  }
+
+  if (conversion_id_regexes_.size() >= kMaximumConversionIdRegexes) {
+    conversion_id_regexes_.clear();
+  }
+
+  iter = conversion_id_regexes_
+             .emplace(pattern, std::make_unique<RE2>(pattern))
+             .first;
+  return *iter->second;
+}
+
 void Conversions::Convert(
     const AdEventInfo& ad_event,
     const VerifiableConversionInfo& verifiable_conversion) {
@@ -7,6 +7,7 @@
 #define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CONVERSIONS_CONVERSIONS_H_
 
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -24,12 +25,17 @@
 
 class GURL;
 
+namespace re2 {
+class RE2;
+}  // namespace re2
+
 namespace brave_ads {
 
 namespace resource {
 class Conversions;
 }  // namespace resource
 
+class ConversionUrlPatternMatcher;
 struct AdEventInfo;
 struct VerifiableConversionInfo;
 
@@ -77,6 +83,16 @@ class Conversions final : public AdsClientNotifierObserver,
                            bool success,
                            const ConversionList& conversions);
 
+  ConversionList FilterConversions(const std::vector<GURL>& redirect_chain,
+                                   const ConversionList& conversions);
+
+  std::string ExtractConversionId(
+      const std::string& html,
+      const std::vector<GURL>& redirect_chain,
+      const std::string& conversion_url_pattern,
+      const ConversionIdPatternMap& conversion_id_patterns);
+  const re2::RE2& GetConversionIdRegex(const std::string& pattern);
+
   void Convert(const AdEventInfo& ad_event,
                const VerifiableConversionInfo& verifiable_conversion);
 
@@ -124,6 +140,12 @@ class Conversions final : public AdsClientNotifierObserver,
 
   std::unique_ptr<resource::Conversions> resource_;
 
+  // Compiled when the set of conversion url patterns changes.
+  std::unique_ptr<ConversionUrlPatternMatcher> url_pattern_matcher_;
+
+  // Compiled conversion id regular expressions keyed by pattern.
+  std::map<std::string, std::unique_ptr<re2::RE2>> conversion_id_regexes_;
+
   Timer timer_;
 
   base::WeakPtrFactory<Conversions> weak_factory_{this};
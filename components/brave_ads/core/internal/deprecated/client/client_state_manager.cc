@@ -101,6 +101,8 @@ ClientStateManager::ClientStateManager() : client_(new ClientInfo()) {
 }
 
 ClientStateManager::~ClientStateManager() {
+  SaveIfNeeded();
+
   DCHECK_EQ(this, g_client_instance);
   g_client_instance = nullptr;
 }
@@ -155,7 +157,7 @@ void ClientStateManager::AppendHistory(const HistoryItemInfo& history_item) {
 
   client_->history_items.erase(iter, client_->history_items.cend());
 
-  Save();
+  SaveAfter(kClientStateHistorySaveDelay);
 #endif
 }
 
@@ -182,7 +184,7 @@ void ClientStateManager::AppendToPurchaseIntentSignalHistoryForSegment(
     client_->purchase_intent_signal_history.at(segment).pop_back();
   }
 
-  Save();
+  SaveAfter(kClientStateHistorySaveDelay);
 }
 
 const targeting::PurchaseIntentSignalHistoryMap&
@@ -498,7 +500,7 @@ void ClientStateManager::AppendTextClassificationProbabilitiesToHistory(
     client_->text_classification_probabilities.resize(maximum_entries);
   }
 
-  Save();
+  SaveAfter(kClientStateHistorySaveDelay);
 }
 
 const targeting::TextClassificationProbabilityList&
@@ -518,13 +520,47 @@ void ClientStateManager::RemoveAllHistory() {
   Save();
 }
 
+void ClientStateManager::SaveIfNeeded() {
+  if (!is_dirty_) {
+    return;
+  }
+
+  SaveNow();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 void ClientStateManager::Save() {
+  SaveAfter(kClientStateSaveDelay);
+}
+
+void ClientStateManager::SaveAfter(const base::TimeDelta delay) {
+  if (!is_initialized_) {
+    return;
+  }
+
+  is_dirty_ = true;
+
+  const base::Time save_at = base::Time::Now() + delay;
+  if (save_timer_.IsRunning() && save_at_ <= save_at) {
+    // A save is already scheduled to happen sooner, so coalesce this mutation
+    // into it.
+    return;
+  }
+
+  save_at_ = save_timer_.Start(FROM_HERE, delay,
+                               base::BindOnce(&ClientStateManager::SaveNow,
+                                              weak_factory_.GetWeakPtr()));
+}
+
+void ClientStateManager::SaveNow() {
   if (!is_initialized_) {
     return;
   }
 
+  save_timer_.Stop();
+  is_dirty_ = false;
+
   BLOG(9, "Saving client state");
 
   const std::string json = client_->ToJson();
@@ -555,7 +591,7 @@ void ClientStateManager::OnLoaded(InitializeCallback callback,
     is_initialized_ = true;
 
     client_ = std::make_unique<ClientInfo>();
-    Save();
+    SaveNow();
   } else {
     if (!FromJson(json)) {
       BLOG(0, "Failed to load client state");
@@ -568,11 +604,13 @@ void ClientStateManager::OnLoaded(InitializeCallback callback,
     BLOG(3, "Successfully loaded client state");
 
     is_initialized_ = true;
-  }
 
-  is_mutated_ = IsMutated(client_->ToJson());
-  if (is_mutated_) {
-    BLOG(9, "Client state is mutated");
+    // The hash was generated from the serialized state when it was last saved,
+    // so compare against the loaded JSON rather than serializing it again.
+    is_mutated_ = IsMutated(json);
+    if (is_mutated_) {
+      BLOG(9, "Client state is mutated");
+    }
   }
 
   std::move(callback).Run(/*success */ true);
@@ -11,11 +11,13 @@
 #include <string>
 
 #include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
 #include "brave/components/brave_ads/core/ad_content_action_types.h"
 #include "brave/components/brave_ads/core/ads_callback.h"
 #include "brave/components/brave_ads/core/category_content_action_types.h"
 #include "brave/components/brave_ads/core/history_item_info.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/targeting/contextual/text_classification/text_classification_alias.h"
+#include "brave/components/brave_ads/core/internal/common/timer/timer.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
 #include "brave/components/brave_ads/core/internal/deprecated/client/preferences/filtered_advertiser_info.h"
 #include "brave/components/brave_ads/core/internal/deprecated/client/preferences/filtered_category_info.h"
@@ -98,8 +100,16 @@ class ClientStateManager final {
 
   bool is_mutated() const { return is_mutated_; }
 
+  // Writes pending client state changes to disk immediately, i.e. on shutdown.
+  void SaveIfNeeded();
+
  private:
+  // Mutations are coalesced and written to disk after a short delay, whereas
+  // appends to the browsing derived histories, which happen for every page
+  // visited, are coalesced over a longer delay.
   void Save();
+  void SaveAfter(base::TimeDelta delay);
+  void SaveNow();
 
   void Load(InitializeCallback callback);
   void OnLoaded(InitializeCallback callback,
@@ -112,6 +122,10 @@ class ClientStateManager final {
 
   bool is_mutated_ = false;
 
+  bool is_dirty_ = false;
+  base::Time save_at_;
+  Timer save_timer_;
+
   bool is_initialized_ = false;
 
   base::WeakPtrFactory<ClientStateManager> weak_factory_{this};
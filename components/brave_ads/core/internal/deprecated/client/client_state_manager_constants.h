@@ -6,10 +6,15 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_DEPRECATED_CLIENT_CLIENT_STATE_MANAGER_CONSTANTS_H_
 #define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_DEPRECATED_CLIENT_CLIENT_STATE_MANAGER_CONSTANTS_H_
 
+#include "base/time/time.h"
+
 namespace brave_ads {
 
 constexpr char kClientStateFilename[] = "client.json";
 
+constexpr base::TimeDelta kClientStateSaveDelay = base::Seconds(5);
+constexpr base::TimeDelta kClientStateHistorySaveDelay = base::Minutes(1);
+
 }  // namespace brave_ads
 
 #endif  // BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_DEPRECATED_CLIENT_CLIENT_STATE_MANAGER_CONSTANTS_H_
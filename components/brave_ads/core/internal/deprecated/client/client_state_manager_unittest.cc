@@ -0,0 +1,106 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/deprecated/client/client_state_manager.h"
+
+#include "base/time/time.h"
+#include "brave/components/brave_ads/core/category_content_action_types.h"
+#include "brave/components/brave_ads/core/internal/common/unittest/unittest_base.h"
+#include "brave/components/brave_ads/core/internal/deprecated/client/client_state_manager_constants.h"
+
+// npm run test -- brave_unit_tests --filter=BatAds*
+
+namespace brave_ads {
+
+using ::testing::_;
+
+class BatAdsClientStateManagerTest : public UnitTestBase {};
+
+TEST_F(BatAdsClientStateManagerTest, CoalesceMutationsIntoSingleSave) {
+  // Arrange
+  EXPECT_CALL(*ads_client_mock_, Save(kClientStateFilename, _, _)).Times(0);
+
+  // Act
+  ClientStateManager::GetInstance()->ToggleMarkToReceiveAdsForCategory(
+      "technology & computing", CategoryContentOptActionType::kNone);
+  ClientStateManager::GetInstance()->ToggleMarkToNoLongerReceiveAdsForCategory(
+      "personal finance-banking", CategoryContentOptActionType::kNone);
+
+  FastForwardClockBy(kClientStateSaveDelay - base::Milliseconds(1));
+
+  // Assert
+  ::testing::Mock::VerifyAndClearExpectations(ads_client_mock_.get());
+
+  EXPECT_CALL(*ads_client_mock_, Save(kClientStateFilename, _, _));
+  FastForwardClockBy(base::Milliseconds(1));
+}
+
+TEST_F(BatAdsClientStateManagerTest, CoalesceHistoryAppendsIntoSingleSave) {
+  // Arrange
+  EXPECT_CALL(*ads_client_mock_, Save(kClientStateFilename, _, _)).Times(0);
+
+  // Act
+  ClientStateManager::GetInstance()
+      ->AppendTextClassificationProbabilitiesToHistory(
+          {{"technology & computing-software", 0.9}});
+  ClientStateManager::GetInstance()
+      ->AppendTextClassificationProbabilitiesToHistory(
+          {{"personal finance-banking", 0.8}});
+
+  FastForwardClockBy(kClientStateHistorySaveDelay - base::Milliseconds(1));
+
+  // Assert
+  ::testing::Mock::VerifyAndClearExpectations(ads_client_mock_.get());
+
+  EXPECT_CALL(*ads_client_mock_, Save(kClientStateFilename, _, _));
+  FastForwardClockBy(base::Milliseconds(1));
+}
+
+TEST_F(BatAdsClientStateManagerTest, MutationSavesSoonerThanHistoryAppend) {
+  // Arrange
+  EXPECT_CALL(*ads_client_mock_, Save(kClientStateFilename, _, _)).Times(0);
+
+  ClientStateManager::GetInstance()
+      ->AppendTextClassificationProbabilitiesToHistory(
+          {{"technology & computing-software", 0.9}});
+
+  // Act
+  ClientStateManager::GetInstance()->ToggleMarkToReceiveAdsForCategory(
+      "technology & computing", CategoryContentOptActionType::kNone);
+
+  FastForwardClockBy(kClientStateSaveDelay - base::Milliseconds(1));
+
+  // Assert
+  ::testing::Mock::VerifyAndClearExpectations(ads_client_mock_.get());
+
+  // The history append is saved along with the mutation, so nothing is left to
+  // save after the longer delay.
+  EXPECT_CALL(*ads_client_mock_, Save(kClientStateFilename, _, _));
+  FastForwardClockBy(kClientStateHistorySaveDelay);
+}
+
+TEST_F(BatAdsClientStateManagerTest, SaveIfNeeded) {
+  // Arrange
+  ClientStateManager::GetInstance()
+      ->AppendTextClassificationProbabilitiesToHistory(
+          {{"technology & computing-software", 0.9}});
+
+  // Assert
+  EXPECT_CALL(*ads_client_mock_, Save(kClientStateFilename, _, _));
+
+  // Act
+  ClientStateManager::GetInstance()->SaveIfNeeded();
+  FastForwardClockBy(kClientStateHistorySaveDelay);
+}
+
+TEST_F(BatAdsClientStateManagerTest, DoNotSaveIfNotNeeded) {
+  // Assert
+  EXPECT_CALL(*ads_client_mock_, Save(kClientStateFilename, _, _)).Times(0);
+
+  // Act
+  ClientStateManager::GetInstance()->SaveIfNeeded();
+}
+
+}  // namespace brave_ads
@@ -30,6 +30,7 @@
 #include "brave/components/brave_ads/core/internal/privacy/tokens/unblinded_payment_tokens/unblinded_payment_token_value_util.h"
 #include "brave/components/brave_ads/core/internal/privacy/tokens/unblinded_payment_tokens/unblinded_payment_tokens.h"
 #include "brave/components/brave_ads/core/internal/privacy/tokens/unblinded_tokens/unblinded_token_info.h"
+#include "brave/components/brave_ads/core/internal/privacy/tokens/unblinded_tokens/unblinded_token_signature_util.h"
 #include "brave/components/brave_ads/core/internal/privacy/tokens/unblinded_tokens/unblinded_token_value_util.h"
 #include "brave/components/brave_ads/core/internal/privacy/tokens/unblinded_tokens/unblinded_tokens.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
@@ -185,20 +186,47 @@ void ConfirmationStateManager::OnLoaded(InitializeCallback callback,
     is_initialized_ = true;
 
     Save();
-  } else {
-    if (!FromJson(json)) {
-      BLOG(0, "Failed to load confirmations state");
 
-      BLOG(3, "Failed to parse confirmations state: " << json);
+    return SuccessfullyInitialized(std::move(callback));
+  }
 
-      return std::move(callback).Run(/*success*/ false);
-    }
+  if (!ParseJson(json)) {
+    BLOG(0, "Failed to load confirmations state");
 
-    BLOG(3, "Successfully loaded confirmations state");
+    BLOG(3, "Failed to parse confirmations state: " << json);
 
-    is_initialized_ = true;
+    return std::move(callback).Run(/*success*/ false);
   }
 
+  const privacy::UnblindedTokenList unblinded_tokens =
+      unblinded_tokens_->GetAllTokens();
+  if (unblinded_tokens.empty()) {
+    return OnDidRemoveUnblindedTokensWithInvalidSignatures(std::move(callback),
+                                                           {});
+  }
+
+  DCHECK(wallet_.IsValid());
+  privacy::RemoveUnblindedTokensWithInvalidSignaturesAsync(
+      unblinded_tokens, wallet_.public_key,
+      base::BindOnce(&ConfirmationStateManager::
+                         OnDidRemoveUnblindedTokensWithInvalidSignatures,
+                     weak_factory_.GetWeakPtr(), std::move(callback)));
+}
+
+void ConfirmationStateManager::OnDidRemoveUnblindedTokensWithInvalidSignatures(
+    InitializeCallback callback,
+    const privacy::UnblindedTokenList& unblinded_tokens) {
+  unblinded_tokens_->SetTokens(unblinded_tokens);
+
+  BLOG(3, "Successfully loaded confirmations state");
+
+  is_initialized_ = true;
+
+  SuccessfullyInitialized(std::move(callback));
+}
+
+void ConfirmationStateManager::SuccessfullyInitialized(
+    InitializeCallback callback) {
   is_mutated_ = IsMutated(ToJson());
   if (is_mutated_) {
     BLOG(9, "Confirmation state is mutated");
@@ -459,6 +487,23 @@ std::string ConfirmationStateManager::ToJson() {
 }
 
 bool ConfirmationStateManager::FromJson(const std::string& json) {
+  if (!ParseJson(json)) {
+    return false;
+  }
+
+  if (!unblinded_tokens_->IsEmpty()) {
+    DCHECK(wallet_.IsValid());
+    unblinded_tokens_->SetTokens(
+        privacy::RemoveUnblindedTokensWithInvalidSignatures(
+            unblinded_tokens_->GetAllTokens(), wallet_.public_key));
+  }
+
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool ConfirmationStateManager::ParseJson(const std::string& json) {
   const absl::optional<base::Value> root = base::JSONReader::Read(json);
   if (!root || !root->is_dict()) {
     return false;
@@ -480,8 +525,6 @@ bool ConfirmationStateManager::FromJson(const std::string& json) {
   return true;
 }
 
-///////////////////////////////////////////////////////////////////////////////
-
 bool ConfirmationStateManager::ParseFailedConfirmationsFromDictionary(
     const base::Value::Dict& dict) {
   const base::Value::Dict* const confirmations = dict.FindDict("confirmations");
@@ -505,27 +548,9 @@ bool ConfirmationStateManager::ParseUnblindedTokensFromDictionary(
     return false;
   }
 
-  privacy::UnblindedTokenList filtered_unblinded_tokens =
-      privacy::UnblindedTokensFromValue(*unblinded_tokens);
-
-  if (!filtered_unblinded_tokens.empty()) {
-    DCHECK(wallet_.IsValid());
-    const std::string public_key = wallet_.public_key;
-
-    filtered_unblinded_tokens.erase(
-        base::ranges::remove_if(
-            filtered_unblinded_tokens,
-            [&public_key](const privacy::UnblindedTokenInfo& unblinded_token) {
-              const absl::optional<std::string> unblinded_token_base64 =
-                  unblinded_token.value.EncodeBase64();
-              return !unblinded_token_base64 ||
-                     !crypto::Verify(*unblinded_token_base64, public_key,
-                                     unblinded_token.signature);
-            }),
-        filtered_unblinded_tokens.cend());
-  }
-
-  unblinded_tokens_->SetTokens(filtered_unblinded_tokens);
+  // Signatures are verified by the caller.
+  unblinded_tokens_->SetTokens(
+      privacy::UnblindedTokensFromValue(*unblinded_tokens));
 
   return true;
 }
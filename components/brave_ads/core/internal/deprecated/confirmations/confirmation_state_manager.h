@@ -14,6 +14,7 @@
 #include "brave/components/brave_ads/core/ads_callback.h"
 #include "brave/components/brave_ads/core/internal/account/confirmations/confirmation_info.h"
 #include "brave/components/brave_ads/core/internal/account/wallet/wallet_info.h"
+#include "brave/components/brave_ads/core/internal/privacy/tokens/unblinded_tokens/unblinded_token_info.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace brave_ads {
@@ -74,6 +75,13 @@ class ConfirmationStateManager final {
   void OnLoaded(InitializeCallback callback,
                 bool success,
                 const std::string& json);
+  void OnDidRemoveUnblindedTokensWithInvalidSignatures(
+      InitializeCallback callback,
+      const privacy::UnblindedTokenList& unblinded_tokens);
+  void SuccessfullyInitialized(InitializeCallback callback);
+
+  // Parses the state without verifying the unblinded token signatures.
+  bool ParseJson(const std::string& json);
 
   bool ParseFailedConfirmationsFromDictionary(const base::Value::Dict& dict);
 
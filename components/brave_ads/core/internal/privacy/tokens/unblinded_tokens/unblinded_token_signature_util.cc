@@ -0,0 +1,119 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/privacy/tokens/unblinded_tokens/unblinded_token_signature_util.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "base/barrier_callback.h"
+#include "base/functional/bind.h"
+#include "base/ranges/algorithm.h"
+#include "base/system/sys_info.h"
+#include "base/task/thread_pool.h"
+#include "brave/components/brave_ads/core/internal/common/crypto/crypto_util.h"
+#include "brave/components/brave_ads/core/internal/privacy/challenge_bypass_ristretto/unblinded_token.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace brave_ads::privacy {
+
+namespace {
+
+// Signature verification is cheap enough that spreading a handful of tokens
+// across workers would cost more in thread hops than it saves.
+constexpr size_t kMinimumUnblindedTokensPerTask = 25;
+
+using IndexedUnblindedTokenList = std::pair<size_t, UnblindedTokenList>;
+
+IndexedUnblindedTokenList RemoveUnblindedTokensWithInvalidSignaturesForIndex(
+    const size_t index,
+    UnblindedTokenList unblinded_tokens,
+    const std::string& public_key) {
+  return {index, RemoveUnblindedTokensWithInvalidSignatures(
+                     std::move(unblinded_tokens), public_key)};
+}
+
+void OnRemoveUnblindedTokensWithInvalidSignatures(
+    RemoveUnblindedTokensWithInvalidSignaturesCallback callback,
+    std::vector<IndexedUnblindedTokenList> indexed_unblinded_tokens) {
+  // Tasks may complete in any order, so restore the original FIFO order.
+  base::ranges::sort(indexed_unblinded_tokens, /*comp*/ {},
+                     &IndexedUnblindedTokenList::first);
+
+  UnblindedTokenList unblinded_tokens;
+  for (auto& [index, tokens] : indexed_unblinded_tokens) {
+    unblinded_tokens.insert(unblinded_tokens.cend(),
+                            std::make_move_iterator(tokens.begin()),
+                            std::make_move_iterator(tokens.end()));
+  }
+
+  std::move(callback).Run(unblinded_tokens);
+}
+
+}  // namespace
+
+bool HasValidSignature(const UnblindedTokenInfo& unblinded_token,
+                       const std::string& public_key) {
+  const absl::optional<std::string> unblinded_token_base64 =
+      unblinded_token.value.EncodeBase64();
+  return unblinded_token_base64 &&
+         crypto::Verify(*unblinded_token_base64, public_key,
+                        unblinded_token.signature);
+}
+
+UnblindedTokenList RemoveUnblindedTokensWithInvalidSignatures(
+    UnblindedTokenList unblinded_tokens,
+    const std::string& public_key) {
+  unblinded_tokens.erase(
+      base::ranges::remove_if(
+          unblinded_tokens,
+          [&public_key](const UnblindedTokenInfo& unblinded_token) {
+            return !HasValidSignature(unblinded_token, public_key);
+          }),
+      unblinded_tokens.cend());
+
+  return unblinded_tokens;
+}
+
+void RemoveUnblindedTokensWithInvalidSignaturesAsync(
+    UnblindedTokenList unblinded_tokens,
+    const std::string& public_key,
+    RemoveUnblindedTokensWithInvalidSignaturesCallback callback) {
+  if (unblinded_tokens.empty()) {
+    return std::move(callback).Run({});
+  }
+
+  const size_t task_count = std::clamp<size_t>(
+      unblinded_tokens.size() / kMinimumUnblindedTokensPerTask, 1,
+      static_cast<size_t>(base::SysInfo::NumberOfProcessors()));
+  const size_t unblinded_tokens_per_task =
+      (unblinded_tokens.size() + task_count - 1) / task_count;
+
+  const auto barrier_callback = base::BarrierCallback<IndexedUnblindedTokenList>(
+      task_count, base::BindOnce(&OnRemoveUnblindedTokensWithInvalidSignatures,
+                                 std::move(callback)));
+
+  for (size_t i = 0; i < task_count; i++) {
+    const auto begin =
+        unblinded_tokens.begin() +
+        std::min(i * unblinded_tokens_per_task, unblinded_tokens.size());
+    const auto end =
+        unblinded_tokens.begin() +
+        std::min((i + 1) * unblinded_tokens_per_task, unblinded_tokens.size());
+
+    base::ThreadPool::PostTaskAndReplyWithResult(
+        FROM_HERE, {base::TaskPriority::USER_VISIBLE},
+        base::BindOnce(&RemoveUnblindedTokensWithInvalidSignaturesForIndex, i,
+                       UnblindedTokenList(std::make_move_iterator(begin),
+                                          std::make_move_iterator(end)),
+                       public_key),
+        barrier_callback);
+  }
+}
+
+}  // namespace brave_ads::privacy
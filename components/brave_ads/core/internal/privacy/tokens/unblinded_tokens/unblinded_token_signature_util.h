@@ -0,0 +1,37 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_PRIVACY_TOKENS_UNBLINDED_TOKENS_UNBLINDED_TOKEN_SIGNATURE_UTIL_H_
+#define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_PRIVACY_TOKENS_UNBLINDED_TOKENS_UNBLINDED_TOKEN_SIGNATURE_UTIL_H_
+
+#include <string>
+
+#include "base/functional/callback.h"
+#include "brave/components/brave_ads/core/internal/privacy/tokens/unblinded_tokens/unblinded_token_info.h"
+
+namespace brave_ads::privacy {
+
+using RemoveUnblindedTokensWithInvalidSignaturesCallback =
+    base::OnceCallback<void(const UnblindedTokenList& unblinded_tokens)>;
+
+bool HasValidSignature(const UnblindedTokenInfo& unblinded_token,
+                       const std::string& public_key);
+
+// Returns |unblinded_tokens| in the same order excluding tokens which were not
+// signed by |public_key|.
+UnblindedTokenList RemoveUnblindedTokensWithInvalidSignatures(
+    UnblindedTokenList unblinded_tokens,
+    const std::string& public_key);
+
+// Same as above, but the signatures are verified in parallel on the thread
+// pool and |callback| is run on the calling sequence.
+void RemoveUnblindedTokensWithInvalidSignaturesAsync(
+    UnblindedTokenList unblinded_tokens,
+    const std::string& public_key,
+    RemoveUnblindedTokensWithInvalidSignaturesCallback callback);
+
+}  // namespace brave_ads::privacy
+
+#endif  // BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_PRIVACY_TOKENS_UNBLINDED_TOKENS_UNBLINDED_TOKEN_SIGNATURE_UTIL_H_
@@ -0,0 +1,124 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/privacy/tokens/unblinded_tokens/unblinded_token_signature_util.h"
+
+#include "base/functional/bind.h"
+#include "brave/components/brave_ads/core/internal/account/wallet/wallet_info.h"
+#include "brave/components/brave_ads/core/internal/account/wallet/wallet_unittest_util.h"
+#include "brave/components/brave_ads/core/internal/common/unittest/unittest_base.h"
+#include "brave/components/brave_ads/core/internal/privacy/tokens/unblinded_tokens/unblinded_tokens_unittest_util.h"
+
+// npm run test -- brave_unit_tests --filter=BatAds*
+
+namespace brave_ads::privacy {
+
+namespace {
+
+UnblindedTokenList GetUnblindedTokensWithInvalidSignatures(const int count) {
+  UnblindedTokenList unblinded_tokens = GetUnblindedTokens(count);
+  for (size_t i = 0; i < unblinded_tokens.size(); i += 2) {
+    // Swap signatures so that every other token has a well-formed signature
+    // which was not generated for the token.
+    unblinded_tokens[i].signature = unblinded_tokens[i + 1].signature;
+  }
+
+  return unblinded_tokens;
+}
+
+}  // namespace
+
+class BatAdsUnblindedTokenSignatureUtilTest : public UnitTestBase {};
+
+TEST_F(BatAdsUnblindedTokenSignatureUtilTest, HasValidSignature) {
+  // Arrange
+  const WalletInfo wallet = GetWalletForTesting();
+
+  // Act
+
+  // Assert
+  EXPECT_TRUE(HasValidSignature(GetUnblindedToken(), wallet.public_key));
+}
+
+TEST_F(BatAdsUnblindedTokenSignatureUtilTest, HasInvalidSignature) {
+  // Arrange
+  const WalletInfo wallet = GetWalletForTesting();
+
+  UnblindedTokenInfo unblinded_token = GetUnblindedToken();
+  unblinded_token.signature = "INVALID";
+
+  // Act
+
+  // Assert
+  EXPECT_FALSE(HasValidSignature(unblinded_token, wallet.public_key));
+}
+
+TEST_F(BatAdsUnblindedTokenSignatureUtilTest,
+       RemoveUnblindedTokensWithInvalidSignatures) {
+  // Arrange
+  const WalletInfo wallet = GetWalletForTesting();
+
+  const UnblindedTokenList unblinded_tokens =
+      GetUnblindedTokensWithInvalidSignatures(/*count*/ 4);
+
+  // Act
+
+  // Assert
+  const UnblindedTokenList expected_unblinded_tokens = {unblinded_tokens.at(1),
+                                                        unblinded_tokens.at(3)};
+  EXPECT_EQ(expected_unblinded_tokens,
+            RemoveUnblindedTokensWithInvalidSignatures(unblinded_tokens,
+                                                       wallet.public_key));
+}
+
+TEST_F(BatAdsUnblindedTokenSignatureUtilTest,
+       RemoveUnblindedTokensWithInvalidSignaturesAsync) {
+  // Arrange
+  const WalletInfo wallet = GetWalletForTesting();
+
+  const UnblindedTokenList unblinded_tokens =
+      GetUnblindedTokensWithInvalidSignatures(/*count*/ 200);
+
+  // Act
+  UnblindedTokenList valid_unblinded_tokens;
+  RemoveUnblindedTokensWithInvalidSignaturesAsync(
+      unblinded_tokens, wallet.public_key,
+      base::BindOnce(
+          [](UnblindedTokenList* valid_unblinded_tokens,
+             const UnblindedTokenList& unblinded_tokens) {
+            *valid_unblinded_tokens = unblinded_tokens;
+          },
+          &valid_unblinded_tokens));
+  task_environment_.RunUntilIdle();
+
+  // Assert
+  EXPECT_EQ(RemoveUnblindedTokensWithInvalidSignatures(unblinded_tokens,
+                                                       wallet.public_key),
+            valid_unblinded_tokens);
+  EXPECT_EQ(100U, valid_unblinded_tokens.size());
+}
+
+TEST_F(BatAdsUnblindedTokenSignatureUtilTest,
+       RemoveEmptyUnblindedTokensWithInvalidSignaturesAsync) {
+  // Arrange
+  const WalletInfo wallet = GetWalletForTesting();
+
+  // Act
+  bool did_run_callback = false;
+  RemoveUnblindedTokensWithInvalidSignaturesAsync(
+      {}, wallet.public_key,
+      base::BindOnce(
+          [](bool* did_run_callback,
+             const UnblindedTokenList& unblinded_tokens) {
+            EXPECT_TRUE(unblinded_tokens.empty());
+            *did_run_callback = true;
+          },
+          &did_run_callback));
+
+  // Assert
+  EXPECT_TRUE(did_run_callback);
+}
+
+}  // namespace brave_ads::privacy
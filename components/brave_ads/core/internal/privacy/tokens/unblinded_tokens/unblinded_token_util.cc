@@ -28,7 +28,7 @@ absl::optional<UnblindedTokenInfo> MaybeGetUnblindedToken() {
       ->GetToken();
 }
 
-const UnblindedTokenList& GetAllUnblindedTokens() {
+UnblindedTokenList GetAllUnblindedTokens() {
   return ConfirmationStateManager::GetInstance()
       ->GetUnblindedTokens()
       ->GetAllTokens();
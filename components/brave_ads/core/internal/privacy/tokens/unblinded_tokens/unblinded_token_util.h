@@ -13,7 +13,7 @@ namespace brave_ads::privacy {
 
 absl::optional<UnblindedTokenInfo> MaybeGetUnblindedToken();
 
-const UnblindedTokenList& GetAllUnblindedTokens();
+UnblindedTokenList GetAllUnblindedTokens();
 
 void AddUnblindedTokens(const UnblindedTokenList& unblinded_tokens);
 
@@ -5,12 +5,39 @@
 
 #include "brave/components/brave_ads/core/internal/privacy/tokens/unblinded_tokens/unblinded_tokens.h"
 
+#include <utility>
+
 #include "base/check_op.h"
 #include "base/containers/contains.h"
-#include "base/ranges/algorithm.h"
+#include "base/strings/strcat.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace brave_ads::privacy {
 
+namespace {
+
+// Base64 never contains a colon, so the key is unique for each combination of
+// value, public key and signature, consistent with |UnblindedTokenInfo|
+// equality. Returns |absl::nullopt| if the token cannot be encoded.
+absl::optional<std::string> GetKey(const UnblindedTokenInfo& unblinded_token) {
+  const absl::optional<std::string> value_base64 =
+      unblinded_token.value.EncodeBase64();
+  if (!value_base64) {
+    return absl::nullopt;
+  }
+
+  const absl::optional<std::string> public_key_base64 =
+      unblinded_token.public_key.EncodeBase64();
+  if (!public_key_base64) {
+    return absl::nullopt;
+  }
+
+  return base::StrCat(
+      {*value_base64, ":", *public_key_base64, ":", unblinded_token.signature});
+}
+
+}  // namespace
+
 UnblindedTokens::UnblindedTokens() = default;
 
 UnblindedTokens::~UnblindedTokens() = default;
@@ -21,52 +48,75 @@ const UnblindedTokenInfo& UnblindedTokens::GetToken() const {
   return unblinded_tokens_.front();
 }
 
-const UnblindedTokenList& UnblindedTokens::GetAllTokens() const {
-  return unblinded_tokens_;
+UnblindedTokenList UnblindedTokens::GetAllTokens() const {
+  return {unblinded_tokens_.cbegin(), unblinded_tokens_.cend()};
 }
 
 void UnblindedTokens::SetTokens(const UnblindedTokenList& unblinded_tokens) {
-  unblinded_tokens_ = unblinded_tokens;
+  RemoveAllTokens();
+
+  for (const auto& unblinded_token : unblinded_tokens) {
+    absl::optional<std::string> key = GetKey(unblinded_token);
+    if (!key) {
+      continue;
+    }
+
+    AddToken(unblinded_token, std::move(*key));
+  }
 }
 
 void UnblindedTokens::AddTokens(const UnblindedTokenList& unblinded_tokens) {
   for (const auto& unblinded_token : unblinded_tokens) {
-    if (TokenExists(unblinded_token)) {
+    absl::optional<std::string> key = GetKey(unblinded_token);
+    if (!key || base::Contains(unblinded_token_index_, *key)) {
       continue;
     }
 
-    unblinded_tokens_.push_back(unblinded_token);
+    AddToken(unblinded_token, std::move(*key));
   }
 }
 
 bool UnblindedTokens::RemoveToken(const UnblindedTokenInfo& unblinded_token) {
-  auto iter = base::ranges::find(unblinded_tokens_, unblinded_token);
+  const absl::optional<std::string> key = GetKey(unblinded_token);
+  if (!key) {
+    return false;
+  }
 
-  if (iter == unblinded_tokens_.cend()) {
+  const auto iter = unblinded_token_index_.find(*key);
+  if (iter == unblinded_token_index_.cend()) {
     return false;
   }
 
-  unblinded_tokens_.erase(iter);
+  unblinded_tokens_.erase(iter->second);
+  unblinded_token_index_.erase(iter);
 
   return true;
 }
 
 void UnblindedTokens::RemoveTokens(const UnblindedTokenList& unblinded_tokens) {
-  unblinded_tokens_.erase(
-      base::ranges::remove_if(
-          unblinded_tokens_,
-          [&unblinded_tokens](const UnblindedTokenInfo& unblinded_token) {
-            return base::Contains(unblinded_tokens, unblinded_token);
-          }),
-      unblinded_tokens_.cend());
+  for (const auto& unblinded_token : unblinded_tokens) {
+    const absl::optional<std::string> key = GetKey(unblinded_token);
+    if (!key) {
+      continue;
+    }
+
+    const auto [begin, end] = unblinded_token_index_.equal_range(*key);
+    for (auto iter = begin; iter != end; ++iter) {
+      unblinded_tokens_.erase(iter->second);
+    }
+    unblinded_token_index_.erase(begin, end);
+  }
 }
 
 void UnblindedTokens::RemoveAllTokens() {
   unblinded_tokens_.clear();
+  unblinded_token_index_.clear();
 }
 
-bool UnblindedTokens::TokenExists(const UnblindedTokenInfo& unblinded_token) {
-  return base::Contains(unblinded_tokens_, unblinded_token);
+bool UnblindedTokens::TokenExists(
+    const UnblindedTokenInfo& unblinded_token) const {
+  const absl::optional<std::string> key = GetKey(unblinded_token);
+  return key && base::Contains(unblinded_token_index_, *key);
 }
 
 int UnblindedTokens::Count() const {
@@ -77,4 +127,13 @@ bool UnblindedTokens::IsEmpty() const {
   return unblinded_tokens_.empty();
 }
 
+///////////////////////////////////////////////////////////////////////////////
+
+void UnblindedTokens::AddToken(const UnblindedTokenInfo& unblinded_token,
+                               std::string key) {
+  const auto iter =
+      unblinded_tokens_.insert(unblinded_tokens_.cend(), unblinded_token);
+  unblinded_token_index_.emplace(std::move(key), iter);
+}
+
 }  // namespace brave_ads::privacy
@@ -6,10 +6,19 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_PRIVACY_TOKENS_UNBLINDED_TOKENS_UNBLINDED_TOKENS_H_
 #define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_PRIVACY_TOKENS_UNBLINDED_TOKENS_UNBLINDED_TOKENS_H_
 
+#include <list>
+#include <map>
+#include <string>
+
 #include "brave/components/brave_ads/core/internal/privacy/tokens/unblinded_tokens/unblinded_token_info.h"
 
 namespace brave_ads::privacy {
 
+// Unblinded tokens are kept in FIFO order. Each token is also indexed in an
+// ordered map by a key derived from its base64 encoded value, public key and
+// signature, so that lookups and removals take logarithmic time instead of
+// re-encoding and comparing every token. Tokens which cannot be encoded are
+// never stored, as they can neither be redeemed nor persisted.
 class UnblindedTokens final {
  public:
   UnblindedTokens();
@@ -23,7 +32,7 @@ class UnblindedTokens final {
   ~UnblindedTokens();
 
   const UnblindedTokenInfo& GetToken() const;
-  const UnblindedTokenList& GetAllTokens() const;
+  UnblindedTokenList GetAllTokens() const;
 
   void SetTokens(const UnblindedTokenList& unblinded_tokens);
 
@@ -33,14 +42,20 @@ class UnblindedTokens final {
   void RemoveTokens(const UnblindedTokenList& unblinded_tokens);
   void RemoveAllTokens();
 
-  bool TokenExists(const UnblindedTokenInfo& unblinded_token);
+  bool TokenExists(const UnblindedTokenInfo& unblinded_token) const;
 
   int Count() const;
 
   bool IsEmpty() const;
 
  private:
-  UnblindedTokenList unblinded_tokens_;
+  void AddToken(const UnblindedTokenInfo& unblinded_token, std::string key);
+
+  std::list<UnblindedTokenInfo> unblinded_tokens_;
+
+  // Tokens with the same key are ordered by insertion, see |std::multimap|.
+  std::multimap<std::string, std::list<UnblindedTokenInfo>::iterator>
+      unblinded_token_index_;
 };
 
 }  // namespace brave_ads::privacy
@@ -6,6 +6,7 @@
 #include "brave/components/brave_ads/core/internal/privacy/tokens/unblinded_tokens/unblinded_tokens.h"
 
 #include "brave/components/brave_ads/core/internal/common/unittest/unittest_base.h"
+#include "brave/components/brave_ads/core/internal/privacy/challenge_bypass_ristretto/public_key_unittest_util.h"
 #include "brave/components/brave_ads/core/internal/privacy/tokens/unblinded_tokens/unblinded_tokens_unittest_util.h"
 
 // npm run test -- brave_unit_tests --filter=BatAds*
@@ -63,6 +64,22 @@ TEST_F(BatAdsUnblindedTokensTest, SetEmptyTokens) {
   EXPECT_TRUE(unblinded_tokens.IsEmpty());
 }
 
+TEST_F(BatAdsUnblindedTokensTest, DoNotSetTokensWhichCannotBeEncoded) {
+  // Arrange
+  UnblindedTokenInfo unblinded_token = GetUnblindedToken();
+  unblinded_token.public_key = cbr::GetInvalidPublicKey();
+
+  UnblindedTokens unblinded_tokens;
+
+  // Act
+  unblinded_tokens.SetTokens({unblinded_token});
+
+  // Assert
+  EXPECT_TRUE(unblinded_tokens.IsEmpty());
+  EXPECT_FALSE(unblinded_tokens.TokenExists(unblinded_token));
+  EXPECT_FALSE(unblinded_tokens.RemoveToken(unblinded_token));
+}
+
 TEST_F(BatAdsUnblindedTokensTest, AddTokens) {
   // Arrange
   const UnblindedTokenList tokens = GetUnblindedTokens(/*count*/ 2);
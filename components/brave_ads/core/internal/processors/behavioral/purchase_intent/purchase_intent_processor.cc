@@ -6,17 +6,14 @@
 #include "brave/components/brave_ads/core/internal/processors/behavioral/purchase_intent/purchase_intent_processor.h"
 
 #include "base/check.h"
-#include "base/ranges/algorithm.h"
-#include "base/strings/string_split.h"
-#include "base/strings/string_util.h"
 #include "brave/components/brave_ads/core/internal/ads_client_helper.h"
 #include "brave/components/brave_ads/core/internal/common/logging_util.h"
 #include "brave/components/brave_ads/core/internal/common/search_engine/search_engine_results_page_util.h"
-#include "brave/components/brave_ads/core/internal/common/strings/string_strip_util.h"
 #include "brave/components/brave_ads/core/internal/common/url/url_util.h"
 #include "brave/components/brave_ads/core/internal/deprecated/client/client_state_manager.h"
 #include "brave/components/brave_ads/core/internal/processors/behavioral/purchase_intent/purchase_intent_signal_info.h"
 #include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_info.h"
+#include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_keyword_util.h"
 #include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_resource.h"
 #include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_signal_history_info.h"
 #include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_site_info.h"
@@ -27,8 +24,6 @@
 
 namespace brave_ads::processor {
 
-using KeywordList = std::vector<std::string>;
-
 namespace {
 
 constexpr uint16_t kPurchaseIntentDefaultSignalWeight = 1;
@@ -44,22 +39,6 @@ void AppendIntentSignalToHistory(
   }
 }
 
-KeywordList ToKeywords(const std::string& value) {
-  const std::string lowercase_value = base::ToLowerASCII(value);
-
-  const std::string stripped_value =
-      StripNonAlphaNumericCharacters(lowercase_value);
-
-  return base::SplitString(stripped_value, " ", base::TRIM_WHITESPACE,
-                           base::SPLIT_WANT_NONEMPTY);
-}
-
-bool IsSubset(KeywordList keywords_lhs, KeywordList keywords_rhs) {
-  base::ranges::sort(keywords_lhs);
-  base::ranges::sort(keywords_rhs);
-  return base::ranges::includes(keywords_lhs, keywords_rhs);
-}
-
 }  // namespace
 
 PurchaseIntent::PurchaseIntent(resource::PurchaseIntent* resource)
@@ -153,40 +132,44 @@ targeting::PurchaseIntentSiteInfo PurchaseIntent::GetSite(
 
 SegmentList PurchaseIntent::GetSegmentsForSearchQuery(
     const std::string& search_query) const {
-  SegmentList segments;
-
-  const KeywordList search_query_keywords = ToKeywords(search_query);
+  const targeting::PurchaseIntentKeywordList search_query_keywords =
+      targeting::ToSortedKeywords(search_query);
 
   const targeting::PurchaseIntentInfo* const purchase_intent = resource_->Get();
   DCHECK(purchase_intent);
 
-  for (const auto& keyword : purchase_intent->segment_keywords) {
-    // Intended behavior relies on early return from list traversal and
-    // implicitely on the ordering of |segment_keywords_| to ensure specific
-    // segments are matched over general segments, e.g. "audi a6" segments
-    // should be returned over "audi" segments if possible
-    if (IsSubset(search_query_keywords, ToKeywords(keyword.keywords))) {
-      segments = keyword.segments;
-      break;
+  // Intended behavior relies on early return from list traversal and
+  // implicitely on the ordering of |segment_keywords_| to ensure specific
+  // segments are matched over general segments, e.g. "audi a6" segments should
+  // be returned over "audi" segments if possible. Candidates are returned in
+  // ascending order to preserve this ordering.
+  for (const size_t index : targeting::GetCandidateKeywordIndexes(
+           purchase_intent->segment_keywords_index, search_query_keywords)) {
+    const targeting::PurchaseIntentSegmentKeywordInfo& keyword =
+        purchase_intent->segment_keywords.at(index);
+    if (targeting::IsSubset(search_query_keywords, keyword.sorted_keywords)) {
+      return keyword.segments;
     }
   }
 
-  return segments;
+  return {};
 }
 
 uint16_t PurchaseIntent::GetFunnelWeightForSearchQuery(
     const std::string& search_query) const {
-  const KeywordList search_query_keywords = ToKeywords(search_query);
+  const targeting::PurchaseIntentKeywordList search_query_keywords =
+      targeting::ToSortedKeywords(search_query);
 
   uint16_t max_weight = kPurchaseIntentDefaultSignalWeight;
 
   const targeting::PurchaseIntentInfo* const purchase_intent = resource_->Get();
   DCHECK(purchase_intent);
 
-  for (const auto& keyword : purchase_intent->funnel_keywords) {
-    const KeywordList keywords = ToKeywords(keyword.keywords);
-
-    if (IsSubset(search_query_keywords, keywords) &&
+  for (const size_t index : targeting::GetCandidateKeywordIndexes(
+           purchase_intent->funnel_keywords_index, search_query_keywords)) {
+    const targeting::PurchaseIntentFunnelKeywordInfo& keyword =
+        purchase_intent->funnel_keywords.at(index);
+    if (targeting::IsSubset(search_query_keywords, keyword.sorted_keywords) &&
         keyword.weight > max_weight) {
       max_weight = keyword.weight;
     }
@@ -7,6 +7,7 @@
 
 #include "base/values.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/targeting/behavioral/purchase_intent/purchase_intent_features.h"
+#include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_keyword_util.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 #include "url/gurl.h"
 
@@ -66,9 +67,11 @@ std::unique_ptr<PurchaseIntentInfo> PurchaseIntentInfo::CreateFromValue(
     return {};
   }
 
+  std::vector<PurchaseIntentKeywordList> segment_keyword_lists;
   for (const auto [keywords, indexes] : *incoming_segment_keywords) {
     PurchaseIntentSegmentKeywordInfo info;
     info.keywords = keywords;
+    info.sorted_keywords = ToSortedKeywords(keywords);
 
     for (const auto& index : indexes.GetList()) {
       DCHECK(index.is_int());
@@ -80,9 +83,13 @@ std::unique_ptr<PurchaseIntentInfo> PurchaseIntentInfo::CreateFromValue(
       info.segments.push_back(segments.at(index.GetInt()));
     }
 
+    segment_keyword_lists.push_back(info.sorted_keywords);
     purchase_intent->segment_keywords.push_back(info);
   }
 
+  purchase_intent->segment_keywords_index =
+      BuildKeywordIndex(segment_keyword_lists);
+
   // Parsing field: "funnel_keywords"
   const base::Value::Dict* const incoming_funnel_keywords =
       resource->FindDict("funnel_keywords");
@@ -91,13 +98,19 @@ std::unique_ptr<PurchaseIntentInfo> PurchaseIntentInfo::CreateFromValue(
     return {};
   }
 
+  std::vector<PurchaseIntentKeywordList> funnel_keyword_lists;
   for (const auto [keywords, weight] : *incoming_funnel_keywords) {
     PurchaseIntentFunnelKeywordInfo info;
     info.keywords = keywords;
+    info.sorted_keywords = ToSortedKeywords(keywords);
     info.weight = weight.GetInt();
+    funnel_keyword_lists.push_back(info.sorted_keywords);
     purchase_intent->funnel_keywords.push_back(info);
   }
 
+  purchase_intent->funnel_keywords_index =
+      BuildKeywordIndex(funnel_keyword_lists);
+
   // Parsing field: "funnel_sites"
   const base::Value::List* const incoming_funnel_sites =
       resource->FindList("funnel_sites");
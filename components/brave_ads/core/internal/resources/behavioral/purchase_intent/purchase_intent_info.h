@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "brave/components/brave_ads/core/internal/ads/serving/targeting/behavioral/purchase_intent/purchase_intent_funnel_keyword_info.h"
+#include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_keyword_util.h"
 #include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_segment_keyword_info.h"
 #include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_site_info.h"
 
@@ -40,6 +41,11 @@ struct PurchaseIntentInfo final {
   std::vector<PurchaseIntentSiteInfo> sites;
   std::vector<PurchaseIntentSegmentKeywordInfo> segment_keywords;
   std::vector<PurchaseIntentFunnelKeywordInfo> funnel_keywords;
+
+  // Indexes into |segment_keywords| and |funnel_keywords| so that matching a
+  // search query only considers keywords which share a keyword with the query.
+  PurchaseIntentKeywordIndex segment_keywords_index;
+  PurchaseIntentKeywordIndex funnel_keywords_index;
 };
 
 }  // namespace brave_ads::targeting
@@ -0,0 +1,80 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_keyword_util.h"
+
+#include <iterator>
+#include <map>
+#include <utility>
+
+#include "base/ranges/algorithm.h"
+#include "base/strings/string_split.h"
+#include "base/strings/string_util.h"
+#include "brave/components/brave_ads/core/internal/common/strings/string_strip_util.h"
+
+namespace brave_ads::targeting {
+
+PurchaseIntentKeywordList ToSortedKeywords(const std::string& value) {
+  const std::string lowercase_value = base::ToLowerASCII(value);
+
+  const std::string stripped_value =
+      StripNonAlphaNumericCharacters(lowercase_value);
+
+  PurchaseIntentKeywordList keywords =
+      base::SplitString(stripped_value, " ", base::TRIM_WHITESPACE,
+                        base::SPLIT_WANT_NONEMPTY);
+  base::ranges::sort(keywords);
+  return keywords;
+}
+
+bool IsSubset(const PurchaseIntentKeywordList& lhs,
+              const PurchaseIntentKeywordList& rhs) {
+  return base::ranges::includes(lhs, rhs);
+}
+
+PurchaseIntentKeywordIndex BuildKeywordIndex(
+    const std::vector<PurchaseIntentKeywordList>& keyword_lists) {
+  std::map<std::string, std::vector<size_t>> index;
+
+  for (size_t i = 0; i < keyword_lists.size(); i++) {
+    // A keyword list can only be a subset of a search query if the query
+    // contains its first keyword, so indexing by that keyword is sufficient.
+    // An empty keyword list is a subset of every query and is indexed by an
+    // empty keyword which is always looked up.
+    const PurchaseIntentKeywordList& keywords = keyword_lists[i];
+    index[keywords.empty() ? std::string() : keywords.front()].push_back(i);
+  }
+
+  return PurchaseIntentKeywordIndex(std::make_move_iterator(index.begin()),
+                                    std::make_move_iterator(index.end()));
+}
+
+std::vector<size_t> GetCandidateKeywordIndexes(
+    const PurchaseIntentKeywordIndex& index,
+    const PurchaseIntentKeywordList& keywords) {
+  std::vector<size_t> candidates;
+
+  const auto iter = index.find(std::string());
+  if (iter != index.cend()) {
+    candidates = iter->second;
+  }
+
+  for (const auto& keyword : keywords) {
+    const auto keyword_iter = index.find(keyword);
+    if (keyword_iter == index.cend()) {
+      continue;
+    }
+
+    candidates.insert(candidates.cend(), keyword_iter->second.cbegin(),
+                      keyword_iter->second.cend());
+  }
+
+  base::ranges::sort(candidates);
+  candidates.erase(base::ranges::unique(candidates), candidates.cend());
+
+  return candidates;
+}
+
+}  // namespace brave_ads::targeting
@@ -0,0 +1,44 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_RESOURCES_BEHAVIORAL_PURCHASE_INTENT_PURCHASE_INTENT_KEYWORD_UTIL_H_
+#define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_RESOURCES_BEHAVIORAL_PURCHASE_INTENT_PURCHASE_INTENT_KEYWORD_UTIL_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+
+namespace brave_ads::targeting {
+
+using PurchaseIntentKeywordList = std::vector<std::string>;
+
+// Maps a keyword to the indexes of the keyword lists whose alphabetically
+// first keyword it is.
+using PurchaseIntentKeywordIndex =
+    base::flat_map<std::string, std::vector<size_t>>;
+
+// Returns the lowercase alphanumeric keywords in |value| sorted alphabetically.
+PurchaseIntentKeywordList ToSortedKeywords(const std::string& value);
+
+// Returns |true| if every keyword in |rhs| is in |lhs|. Both lists must be
+// sorted.
+bool IsSubset(const PurchaseIntentKeywordList& lhs,
+              const PurchaseIntentKeywordList& rhs);
+
+PurchaseIntentKeywordIndex BuildKeywordIndex(
+    const std::vector<PurchaseIntentKeywordList>& keyword_lists);
+
+// Returns the indexes, in ascending order, of the keyword lists in |index|
+// which could be a subset of |keywords|. Each candidate must still be checked
+// using |IsSubset|.
+std::vector<size_t> GetCandidateKeywordIndexes(
+    const PurchaseIntentKeywordIndex& index,
+    const PurchaseIntentKeywordList& keywords);
+
+}  // namespace brave_ads::targeting
+
+#endif  // BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_RESOURCES_BEHAVIORAL_PURCHASE_INTENT_PURCHASE_INTENT_KEYWORD_UTIL_H_
@@ -0,0 +1,74 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/resources/behavioral/purchase_intent/purchase_intent_keyword_util.h"
+
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=BatAds*
+
+namespace brave_ads::targeting {
+
+TEST(BatAdsPurchaseIntentKeywordUtilTest, ToSortedKeywords) {
+  // Arrange
+
+  // Act
+
+  // Assert
+  const PurchaseIntentKeywordList expected_keywords = {"a6", "audi", "price"};
+  EXPECT_EQ(expected_keywords, ToSortedKeywords("Audi A6, Price!"));
+}
+
+TEST(BatAdsPurchaseIntentKeywordUtilTest, IsSubset) {
+  // Arrange
+
+  // Act
+
+  // Assert
+  EXPECT_TRUE(IsSubset(ToSortedKeywords("latest audi a6 price"),
+                       ToSortedKeywords("audi a6")));
+}
+
+TEST(BatAdsPurchaseIntentKeywordUtilTest, IsNotSubset) {
+  // Arrange
+
+  // Act
+
+  // Assert
+  EXPECT_FALSE(IsSubset(ToSortedKeywords("latest audi a4 price"),
+                        ToSortedKeywords("audi a6")));
+}
+
+TEST(BatAdsPurchaseIntentKeywordUtilTest, GetCandidateKeywordIndexes) {
+  // Arrange
+  const PurchaseIntentKeywordIndex index =
+      BuildKeywordIndex({ToSortedKeywords("audi a6"), ToSortedKeywords("bmw"),
+                         ToSortedKeywords("audi"), ToSortedKeywords("")});
+
+  // Act
+  const std::vector<size_t> candidates =
+      GetCandidateKeywordIndexes(index, ToSortedKeywords("audi a6 price"));
+
+  // Assert
+  const std::vector<size_t> expected_candidates = {0, 2, 3};
+  EXPECT_EQ(expected_candidates, candidates);
+}
+
+TEST(BatAdsPurchaseIntentKeywordUtilTest, GetEmptyCandidateKeywordIndexes) {
+  // Arrange
+  const PurchaseIntentKeywordIndex index = BuildKeywordIndex(
+      {ToSortedKeywords("audi a6"), ToSortedKeywords("bmw")});
+
+  // Act
+  const std::vector<size_t> candidates =
+      GetCandidateKeywordIndexes(index, ToSortedKeywords("mercedes"));
+
+  // Assert
+  EXPECT_TRUE(candidates.empty());
+}
+
+}  // namespace brave_ads::targeting
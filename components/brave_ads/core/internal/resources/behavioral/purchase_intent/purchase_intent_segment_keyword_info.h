@@ -7,6 +7,7 @@
 #define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_RESOURCES_BEHAVIORAL_PURCHASE_INTENT_PURCHASE_INTENT_SEGMENT_KEYWORD_INFO_H_
 
 #include <string>
+#include <vector>
 
 #include "brave/components/brave_ads/core/internal/segments/segment_alias.h"
 
@@ -30,6 +31,8 @@ struct PurchaseIntentSegmentKeywordInfo final {
 
   SegmentList segments;
   std::string keywords;
+  // |keywords| tokenized and sorted when the resource is loaded.
+  std::vector<std::string> sorted_keywords;
 };
 
 }  // namespace brave_ads::targeting
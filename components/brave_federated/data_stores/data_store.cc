@@ -85,7 +85,8 @@ bool DataStore::InitializeDatabase() {
 }
 
 int DataStore::GetNextTrainingInstanceId() {
-  sql::Statement statement(database_.GetUniqueStatement(
+  sql::Statement statement(database_.GetCachedStatement(
+      SQL_FROM_HERE,
       base::StringPrintf("SELECT MAX(training_instance_id) FROM %s",
                          data_store_task_.name.c_str())
           .c_str()));
@@ -96,11 +97,14 @@ int DataStore::GetNextTrainingInstanceId() {
   return 0;
 }
 
-void DataStore::SaveCovariate(
+bool DataStore::SaveCovariate(
     const brave_federated::mojom::CovariateInfo& covariate,
     int training_instance_id,
     const base::Time created_at) {
-  sql::Statement statement(database_.GetUniqueStatement(
+  // The statement is prepared once per database and reused for every
+  // covariate.
+  sql::Statement statement(database_.GetCachedStatement(
+      SQL_FROM_HERE,
       base::StringPrintf("INSERT INTO %s (training_instance_id, "
                          "feature_name, feature_type, "
                          "feature_value, created_at) "
@@ -110,7 +114,7 @@ void DataStore::SaveCovariate(
 
   BindCovariateToStatement(covariate, training_instance_id, created_at,
                            &statement);
-  statement.Run();
+  return statement.Run();
 }
 
 bool DataStore::AddTrainingInstance(
@@ -118,14 +122,24 @@ bool DataStore::AddTrainingInstance(
         training_instance) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
+  // Write all covariates of the instance in a single transaction, so that
+  // they are committed (and synced to disk) at once and a partially written
+  // instance is never observed.
+  sql::Transaction transaction(&database_);
+  if (!transaction.Begin()) {
+    return false;
+  }
+
   const int training_instance_id = GetNextTrainingInstanceId();
   const base::Time created_at = base::Time::Now();
 
   for (const auto& covariate : training_instance) {
-    SaveCovariate(*covariate, training_instance_id, created_at);
+    if (!SaveCovariate(*covariate, training_instance_id, created_at)) {
+      return false;
+    }
   }
 
-  return true;
+  return transaction.Commit();
 }
 
 TrainingData DataStore::LoadTrainingData() {
@@ -167,9 +181,15 @@ bool DataStore::DeleteTrainingData() {
 void DataStore::PurgeTrainingDataAfterExpirationDate() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
-  sql::Statement delete_statement(database_.GetUniqueStatement(
-      base::StringPrintf(" DELETE FROM %s WHERE created_at < ? OR id NOT IN "
-                         "(SELECT id FROM %s ORDER BY id DESC LIMIT ?)",
+  // Expired rows are found through the created_at index. Only the newest
+  // |max_number_of_records| rows are kept, so everything at or below the id
+  // found that many rows down the primary key is dropped as well. If there are
+  // fewer rows, the sub-select yields NULL and nothing is deleted by it.
+  sql::Statement delete_statement(database_.GetCachedStatement(
+      SQL_FROM_HERE,
+      base::StringPrintf("DELETE FROM %s WHERE created_at < ? OR id <= "
+                         "(SELECT id FROM %s ORDER BY id DESC LIMIT 1 "
+                         "OFFSET ?)",
                          data_store_task_.name.c_str(),
                          data_store_task_.name.c_str())
           .c_str()));
@@ -181,19 +201,29 @@ void DataStore::PurgeTrainingDataAfterExpirationDate() {
 }
 
 bool DataStore::MaybeCreateTable() {
-  if (database_.DoesTableExist(data_store_task_.name)) {
-    return true;
+  sql::Transaction transaction(&database_);
+  if (!transaction.Begin()) {
+    return false;
   }
 
-  sql::Transaction transaction(&database_);
-  return transaction.Begin() &&
-         database_.Execute(
-             base::StringPrintf(
-                 "CREATE TABLE %s (id INTEGER PRIMARY KEY AUTOINCREMENT, "
-                 "training_instance_id INTEGER NOT NULL, feature_name INTEGER "
-                 "NOT NULL, feature_type INTEGER NOT NULL, "
-                 "feature_value TEXT NOT NULL, created_at DOUBLE NOT NULL)",
-                 data_store_task_.name.c_str())
+  if (!database_.DoesTableExist(data_store_task_.name) &&
+      !database_.Execute(
+          base::StringPrintf(
+              "CREATE TABLE %s (id INTEGER PRIMARY KEY AUTOINCREMENT, "
+              "training_instance_id INTEGER NOT NULL, feature_name INTEGER "
+              "NOT NULL, feature_type INTEGER NOT NULL, "
+              "feature_value TEXT NOT NULL, created_at DOUBLE NOT NULL)",
+              data_store_task_.name.c_str())
+              .c_str())) {
+    return false;
+  }
+
+  // Databases created before the index was introduced get it here too.
+  return database_.Execute(
+             base::StringPrintf("CREATE INDEX IF NOT EXISTS %s_created_at "
+                                "ON %s(created_at)",
+                                data_store_task_.name.c_str(),
+                                data_store_task_.name.c_str())
                  .c_str()) &&
          transaction.Commit();
 }
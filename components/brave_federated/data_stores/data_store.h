@@ -38,9 +38,10 @@ class DataStore {
   bool InitializeDatabase();
 
   int GetNextTrainingInstanceId();
-  void SaveCovariate(const brave_federated::mojom::CovariateInfo& covariate,
+  bool SaveCovariate(const brave_federated::mojom::CovariateInfo& covariate,
                      int training_instance_id,
                      const base::Time created_at);
+  // Adds all covariates of |training_instance| in one transaction.
   bool AddTrainingInstance(
       const std::vector<brave_federated::mojom::CovariateInfoPtr>
           training_instance);
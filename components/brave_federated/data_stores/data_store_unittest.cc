@@ -192,4 +192,27 @@ TEST_F(DataStoreTest, PurgeTrainingDataAfterExpirationDate) {
   EXPECT_EQ(0, RecordCount());
 }
 
+TEST_F(DataStoreTest, PurgeTrainingDataAboveMaxNumberOfRecords) {
+  EXPECT_TRUE(
+      data_store_->database_.DoesIndexExist("test_federated_task_created_at"));
+
+  for (int i = 0; i < 30; ++i) {
+    TrainingData training_data = TrainingDataFromTestInfo();
+    EXPECT_TRUE(AddTrainingInstance(std::move(training_data[0])));
+  }
+  EXPECT_EQ(60, RecordCount());
+
+  data_store_->PurgeTrainingDataAfterExpirationDate();
+
+  // Only the 50 newest records are kept, i.e. the first 5 instances are gone.
+  EXPECT_EQ(50, RecordCount());
+  EXPECT_EQ(25, TrainingInstanceCount());
+  TrainingData training_data = data_store_->LoadTrainingData();
+  EXPECT_FALSE(training_data.contains(5));
+  EXPECT_TRUE(training_data.contains(6));
+
+  data_store_->PurgeTrainingDataAfterExpirationDate();
+  EXPECT_EQ(50, RecordCount());
+}
+
 }  // namespace brave_federated
@@ -10,13 +10,19 @@
 #include <numeric>
 #include <utility>
 
+#include "base/containers/flat_map.h"
 #include "base/logging.h"
+#include "base/no_destructor.h"
+#include "base/strings/string_util.h"
 #include "brave/components/brave_perf_predictor/browser/bandwidth_linreg_parameters.h"
 
 namespace brave_perf_predictor {
 
 namespace {
 
+constexpr char kThirdPartyFeaturePrefix[] = "thirdParties.";
+constexpr char kThirdPartyBlockedFeatureSuffix[] = ".blocked";
+
 bool StandardiseFeatsNoOutliers(
     std::array<double, standardise_feat_count>* features,
     const std::array<double, standardise_feat_count>& means,
@@ -37,6 +43,25 @@ bool StandardiseFeatsNoOutliers(
 
 }  // namespace
 
+size_t GetThirdPartyBlockedFeatureIndex(base::StringPiece third_party_name) {
+  static const base::NoDestructor<base::flat_map<base::StringPiece, size_t>>
+      third_party_feature_indices([] {
+        std::vector<std::pair<base::StringPiece, size_t>> indices;
+        for (size_t i = 0; i < feature_count; ++i) {
+          base::StringPiece name = feature_sequence[i];
+          if (base::StartsWith(name, kThirdPartyFeaturePrefix) &&
+              base::EndsWith(name, kThirdPartyBlockedFeatureSuffix)) {
+            name.remove_prefix(sizeof(kThirdPartyFeaturePrefix) - 1);
+            name.remove_suffix(sizeof(kThirdPartyBlockedFeatureSuffix) - 1);
+            indices.emplace_back(name, i);
+          }
+        }
+        return base::flat_map<base::StringPiece, size_t>(std::move(indices));
+      }());
+  auto it = third_party_feature_indices->find(third_party_name);
+  return it != third_party_feature_indices->end() ? it->second : feature_count;
+}
+
 double LinregPredictVector(const std::array<double, feature_count>& features) {
   // Standardise numeric features
   std::array<double, standardise_feat_count> numeric_features;
@@ -68,7 +93,7 @@ double LinregPredictVector(const std::array<double, feature_count>& features) {
 double LinregPredictNamed(const base::flat_map<std::string, double>& features) {
   std::array<double, feature_count> feature_vector{};
   for (unsigned int i = 0; i < feature_count; i++) {
-    auto it = features.find(feature_sequence.at(i));
+    auto it = features.find(feature_sequence[i]);
     if (it != features.end())
       feature_vector[i] = it->second;
   }
@@ -6,10 +6,12 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_PERF_PREDICTOR_BROWSER_BANDWIDTH_LINREG_H_
 #define BRAVE_COMPONENTS_BRAVE_PERF_PREDICTOR_BROWSER_BANDWIDTH_LINREG_H_
 
+#include <array>
 #include <string>
 #include <vector>
 
 #include "base/containers/flat_map.h"
+#include "base/strings/string_piece.h"
 #include "brave/components/brave_perf_predictor/browser/bandwidth_linreg_parameters.h"
 
 namespace brave_perf_predictor {
@@ -18,6 +20,22 @@ constexpr double kOutlierThreshold = 6;
 // if above 20MB _and_ more than 6x of the transfer size, probably an outlier
 constexpr double kSavingsAbsoluteOutlier = 20 << 20;
 
+// Returns the position of |name| in |feature_sequence|, or |feature_count| if
+// the model does not use such a feature. Usable in constant expressions, so
+// fixed feature names can be resolved at compile time.
+constexpr size_t GetFeatureIndex(base::StringPiece name) {
+  for (size_t i = 0; i < feature_count; ++i) {
+    if (feature_sequence[i] == name) {
+      return i;
+    }
+  }
+  return feature_count;
+}
+
+// Returns the position of the "thirdParties.<name>.blocked" feature, or
+// |feature_count| if the model does not use it.
+size_t GetThirdPartyBlockedFeatureIndex(base::StringPiece third_party_name);
+
 // Computes prediction based on the provided feature vector.
 // It is the client's responsibility to provide features in
 // the exact order expected by the predictor.
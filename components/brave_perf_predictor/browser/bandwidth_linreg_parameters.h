@@ -13,6 +13,7 @@
 
 #include "base/containers/flat_set.h"
 #include "base/containers/flat_map.h"
+#include "base/strings/string_piece.h"
 
 namespace brave_perf_predictor {
 
@@ -288,7 +289,7 @@ constexpr std::array<double, standardise_feat_count> standardise_feat_scale = {
 3333644.900695055
 };
 
-const std::array<std::string, feature_count> feature_sequence{
+constexpr std::array<base::StringPiece, feature_count> feature_sequence{
     "adblockRequests",
     "metrics.firstMeaningfulPaint",
     "metrics.observedDomContentLoaded",
@@ -54,7 +54,7 @@ TEST(BraveSavingsPredictorTest, HandlesEmptyFeatureset) {
 TEST(BraveSavingsPredictorTest, HandlesCompleteFeatureset) {
   base::flat_map<std::string, double> features;
   for (unsigned int i = 0; i < feature_count; i++) {
-    features[feature_sequence.at(i)] = 0;
+    features[std::string(feature_sequence[i])] = 0;
   }
   const double result = LinregPredictNamed(features);
   const std::array<double, feature_count> array_features{};
@@ -62,6 +62,22 @@ TEST(BraveSavingsPredictorTest, HandlesCompleteFeatureset) {
   EXPECT_EQ(result, array_result);
 }
 
+TEST(BraveSavingsPredictorTest, LooksUpFeatureIndices) {
+  static_assert(GetFeatureIndex("adblockRequests") == 0);
+  EXPECT_EQ(feature_sequence[GetFeatureIndex("resources.total.size")],
+            "resources.total.size");
+  EXPECT_EQ(GetFeatureIndex("transfer.total.size"),
+            static_cast<size_t>(feature_count));
+
+  EXPECT_EQ(feature_sequence[GetThirdPartyBlockedFeatureIndex("Salesforce")],
+            "thirdParties.Salesforce.blocked");
+  EXPECT_EQ(
+      feature_sequence[GetThirdPartyBlockedFeatureIndex("Salesforce.com")],
+      "thirdParties.Salesforce.com.blocked");
+  EXPECT_EQ(GetThirdPartyBlockedFeatureIndex("Unknown Third Party"),
+            static_cast<size_t>(feature_count));
+}
+
 TEST(BraveSavingsPredictorTest, HandesSpecificFeaturemapExample) {
   // This test needs to be updated for any change in the model
   // Third-parties that are not detected are skipped
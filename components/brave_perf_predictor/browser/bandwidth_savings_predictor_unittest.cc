@@ -7,10 +7,9 @@
 
 #include <memory>
 
-#include "base/containers/flat_map.h"
-#include "base/run_loop.h"
-#include "base/test/task_environment.h"
+#include "base/strings/string_piece.h"
 #include "base/time/time.h"
+#include "brave/components/brave_perf_predictor/browser/bandwidth_linreg.h"
 #include "chrome/browser/predictors/loading_test_util.h"
 #include "components/page_load_metrics/common/page_load_metrics.mojom.h"
 #include "components/page_load_metrics/common/page_load_timing.h"
@@ -24,57 +23,56 @@ class BandwidthSavingsPredictorTest : public ::testing::Test {
  public:
   BandwidthSavingsPredictorTest() {
     tp_registry_ = std::make_unique<NamedThirdPartyRegistry>();
-    tp_registry_->InitializeDefault();
     predictor_ =
         std::make_unique<BandwidthSavingsPredictor>(tp_registry_.get());
-    // Allow the third party registry to initialize
-    env_.RunUntilIdle();
   }
 
  protected:
-  base::test::TaskEnvironment env_;
+  double GetFeature(base::StringPiece name) const {
+    return predictor_->features_[GetFeatureIndex(name)];
+  }
+
   std::unique_ptr<NamedThirdPartyRegistry> tp_registry_;
   std::unique_ptr<BandwidthSavingsPredictor> predictor_;
 };
 
 TEST_F(BandwidthSavingsPredictorTest, FeaturiseBlocked) {
   predictor_->OnSubresourceBlocked("https://google-analytics.com");
-  EXPECT_EQ(predictor_->feature_map_["adblockRequests"], 1);
-  EXPECT_EQ(predictor_->feature_map_["thirdParties.Google Analytics.blocked"],
-            1);
+  EXPECT_EQ(GetFeature("adblockRequests"), 1);
+  EXPECT_EQ(GetFeature("thirdParties.Google Analytics.blocked"), 1);
   predictor_->OnSubresourceBlocked("https://test.m.facebook.com");
-  EXPECT_EQ(predictor_->feature_map_["adblockRequests"], 2);
+  EXPECT_EQ(GetFeature("adblockRequests"), 2);
 }
 
 TEST_F(BandwidthSavingsPredictorTest, FeaturiseTiming) {
   const auto empty_timing = page_load_metrics::CreatePageLoadTiming();
   predictor_->OnPageLoadTimingUpdated(*empty_timing);
-  EXPECT_EQ(predictor_->feature_map_["metrics.firstMeaningfulPaint"], 0);
-  EXPECT_EQ(predictor_->feature_map_["metrics.observedDomContentLoaded"], 0);
-  EXPECT_EQ(predictor_->feature_map_["metrics.observedFirstVisualChange"], 0);
-  EXPECT_EQ(predictor_->feature_map_["metrics.observedLoad"], 0);
+  EXPECT_EQ(GetFeature("metrics.firstMeaningfulPaint"), 0);
+  EXPECT_EQ(GetFeature("metrics.observedDomContentLoaded"), 0);
+  EXPECT_EQ(GetFeature("metrics.observedFirstVisualChange"), 0);
+  EXPECT_EQ(GetFeature("metrics.observedLoad"), 0);
 
   auto timing = page_load_metrics::CreatePageLoadTiming();
   timing->document_timing->dom_content_loaded_event_start =
       base::Milliseconds(1000);
   predictor_->OnPageLoadTimingUpdated(*timing);
-  EXPECT_EQ(predictor_->feature_map_["metrics.observedDomContentLoaded"], 1000);
+  EXPECT_EQ(GetFeature("metrics.observedDomContentLoaded"), 1000);
 
   timing->document_timing->load_event_start = base::Milliseconds(2000);
   predictor_->OnPageLoadTimingUpdated(*timing);
-  EXPECT_EQ(predictor_->feature_map_["metrics.observedLoad"], 2000);
+  EXPECT_EQ(GetFeature("metrics.observedLoad"), 2000);
 
   timing->paint_timing->first_meaningful_paint = base::Milliseconds(1500);
   predictor_->OnPageLoadTimingUpdated(*timing);
-  EXPECT_EQ(predictor_->feature_map_["metrics.firstMeaningfulPaint"], 1500);
+  EXPECT_EQ(GetFeature("metrics.firstMeaningfulPaint"), 1500);
 
   timing->paint_timing->first_contentful_paint = base::Milliseconds(800);
   predictor_->OnPageLoadTimingUpdated(*timing);
-  EXPECT_EQ(predictor_->feature_map_["metrics.observedFirstVisualChange"], 800);
+  EXPECT_EQ(GetFeature("metrics.observedFirstVisualChange"), 800);
 }
 
 TEST_F(BandwidthSavingsPredictorTest, FeaturiseResourceLoading) {
-  EXPECT_EQ(predictor_->feature_map_["resources.third-party.requestCount"], 0);
+  EXPECT_EQ(GetFeature("resources.third-party.requestCount"), 0);
 
   const GURL main_frame("https://brave.com/");
 
@@ -83,9 +81,9 @@ TEST_F(BandwidthSavingsPredictorTest, FeaturiseResourceLoading) {
       network::mojom::RequestDestination::kStyle);
   fp_style->raw_body_bytes = 1000;
   predictor_->OnResourceLoadComplete(main_frame, *fp_style);
-  EXPECT_EQ(predictor_->feature_map_["resources.third-party.requestCount"], 0);
-  EXPECT_EQ(predictor_->feature_map_["resources.stylesheet.requestCount"], 1);
-  EXPECT_EQ(predictor_->feature_map_["resources.stylesheet.size"], 1000);
+  EXPECT_EQ(GetFeature("resources.third-party.requestCount"), 0);
+  EXPECT_EQ(GetFeature("resources.stylesheet.requestCount"), 1);
+  EXPECT_EQ(GetFeature("resources.stylesheet.size"), 1000);
 
   auto tp_style = predictors::CreateResourceLoadInfo(
       "https://stackpath.bootstrapcdn.com/bootstrap/4.4.1/css/bootstrap.min.js",
@@ -93,14 +91,14 @@ TEST_F(BandwidthSavingsPredictorTest, FeaturiseResourceLoading) {
   tp_style->raw_body_bytes = 1001;
   predictor_->OnResourceLoadComplete(main_frame, *tp_style);
 
-  EXPECT_EQ(predictor_->feature_map_["resources.third-party.requestCount"], 1);
-  EXPECT_EQ(predictor_->feature_map_["resources.stylesheet.requestCount"], 1);
-  EXPECT_EQ(predictor_->feature_map_["resources.script.requestCount"], 1);
-  EXPECT_EQ(predictor_->feature_map_["resources.stylesheet.size"], 1000);
-  EXPECT_EQ(predictor_->feature_map_["resources.script.size"], 1001);
+  EXPECT_EQ(GetFeature("resources.third-party.requestCount"), 1);
+  EXPECT_EQ(GetFeature("resources.stylesheet.requestCount"), 1);
+  EXPECT_EQ(GetFeature("resources.script.requestCount"), 1);
+  EXPECT_EQ(GetFeature("resources.stylesheet.size"), 1000);
+  EXPECT_EQ(GetFeature("resources.script.size"), 1001);
 
-  EXPECT_EQ(predictor_->feature_map_["resources.total.requestCount"], 2);
-  EXPECT_EQ(predictor_->feature_map_["resources.total.size"], 2001);
+  EXPECT_EQ(GetFeature("resources.total.requestCount"), 2);
+  EXPECT_EQ(GetFeature("resources.total.size"), 2001);
 }
 
 TEST_F(BandwidthSavingsPredictorTest, PredictZeroNoData) {
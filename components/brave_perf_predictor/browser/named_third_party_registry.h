@@ -6,19 +6,18 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_PERF_PREDICTOR_BROWSER_NAMED_THIRD_PARTY_REGISTRY_H_
 #define BRAVE_COMPONENTS_BRAVE_PERF_PREDICTOR_BROWSER_NAMED_THIRD_PARTY_REGISTRY_H_
 
-#include <string>
-#include <tuple>
-
-#include "base/containers/flat_map.h"
-#include "base/memory/weak_ptr.h"
-#include "base/values.h"
+#include "base/strings/string_piece.h"
 #include "components/keyed_service/core/keyed_service.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace brave_perf_predictor {
 
 // Retrieves publicly known Third Party (organisation) for a given URL, using
 // data from the Third Party Web repository
-// (https://github.com/patrickhulce/third-party-web).
+// (https://github.com/patrickhulce/third-party-web). Only entities relevant to
+// the bandwidth prediction model (i.e. those seen in training the model) are
+// known. The lookup tables are generated at build time from
+// resources/entities-httparchive-nostats.json.
 class NamedThirdPartyRegistry : public KeyedService {
  public:
   NamedThirdPartyRegistry();
@@ -27,27 +26,8 @@ class NamedThirdPartyRegistry : public KeyedService {
   NamedThirdPartyRegistry(const NamedThirdPartyRegistry&) = delete;
   NamedThirdPartyRegistry& operator=(const NamedThirdPartyRegistry&) = delete;
 
-  // Parse the provided mappings (in JSON format), potentially discarding
-  // entities not relevant to the bandwith prediction model (i.e. those not
-  // seen in training the model).
-  bool LoadMappings(const base::StringPiece entities, bool discard_irrelevant);
-  // Default initialization - asynchronously load from bundled resource
-  void InitializeDefault();
-  absl::optional<std::string> GetThirdParty(
-      const base::StringPiece domain) const;
-
- private:
-  bool IsInitialized() const { return initialized_; }
-  void MarkInitialized(bool initialized) { initialized_ = initialized; }
-  void UpdateMappings(
-      std::tuple<base::flat_map<std::string, std::string>,
-                 base::flat_map<std::string, std::string>> entity_mappings);
-
-  bool initialized_ = false;
-  base::flat_map<std::string, std::string> entity_by_domain_;
-  base::flat_map<std::string, std::string> entity_by_root_domain_;
-
-  base::WeakPtrFactory<NamedThirdPartyRegistry> weak_factory_{this};
+  absl::optional<base::StringPiece> GetThirdParty(
+      const base::StringPiece request_url) const;
 };
 
 }  // namespace brave_perf_predictor
@@ -31,9 +31,7 @@ NamedThirdPartyRegistryFactory::~NamedThirdPartyRegistryFactory() = default;
 
 KeyedService* NamedThirdPartyRegistryFactory::BuildServiceInstanceFor(
     content::BrowserContext* context) const {
-  auto* registry = new NamedThirdPartyRegistry();
-  registry->InitializeDefault();
-  return registry;
+  return new NamedThirdPartyRegistry();
 }
 
 bool NamedThirdPartyRegistryFactory::ServiceIsCreatedWithBrowserContext()
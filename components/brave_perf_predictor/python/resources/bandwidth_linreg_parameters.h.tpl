@@ -13,6 +13,7 @@
 
 #include "base/containers/flat_set.h"
 #include "base/containers/flat_map.h"
+#include "base/strings/string_piece.h"
 
 namespace brave_perf_predictor {
 
@@ -32,7 +33,7 @@ constexpr std::array<double, standardise_feat_count> standardise_feat_scale = {
 {{transformers.standardise.scale | join(',\n')}}
 };
 
-const std::array<std::string, feature_count> feature_sequence{
+constexpr std::array<base::StringPiece, feature_count> feature_sequence{
     {% for feature in transformers.standardise.features %}
     "{{feature}}",
     {% endfor %}
@@ -0,0 +1,238 @@
+#!/usr/bin/env python3
+# Copyright (c) 2023 The Brave Authors. All rights reserved.
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this file,
+# You can obtain one at https://mozilla.org/MPL/2.0/.
+
+"""
+Generates the static third-party lookup tables used by
+NamedThirdPartyRegistry from the third-party-web entities list.
+
+Only entities the bandwidth model was trained on (|relevant_entities| in
+bandwidth_linreg_parameters.h) are kept. Both the domain and the root domain
+(eTLD+1) tables are perfect hash tables built with hash-and-displace: a key is
+first hashed into a bucket, and the bucket's seed is used to hash it again into
+its slot. The hash is 32-bit FNV-1a seeded by xor-ing the offset basis, and
+must match ThirdPartyTableHash() in named_third_party_registry.cc.
+"""
+
+import argparse
+import ipaddress
+import json
+import re
+
+_FNV_OFFSET_BASIS = 2166136261
+_FNV_PRIME = 16777619
+_NO_ENTITY = 0xffff
+_MAX_SEED = 0xffff
+
+
+def main():
+  args = _get_args()
+  entity_names, domains, root_domains = _build_mappings(
+      _load_entities(args.entities),
+      _load_relevant_entities(args.parameters),
+      _load_public_suffix_rules(args.public_suffix_list))
+  with open(args.output, 'w', encoding='utf-8') as output:
+    output.write(_generate(entity_names, domains, root_domains))
+
+
+def _get_args():
+  parser = argparse.ArgumentParser()
+  parser.add_argument('--entities',
+                      required=True,
+                      help='Path to the third-party-web entities JSON')
+  parser.add_argument('--parameters',
+                      required=True,
+                      help='Path to bandwidth_linreg_parameters.h')
+  parser.add_argument('--public-suffix-list',
+                      required=True,
+                      help='Path to effective_tld_names.dat')
+  parser.add_argument('--output',
+                      required=True,
+                      help='Path to the -inc.cc file to be generated')
+  return parser.parse_args()
+
+
+def _load_entities(path):
+  with open(path, encoding='utf-8') as entities_file:
+    return json.load(entities_file)
+
+
+def _load_relevant_entities(path):
+  with open(path, encoding='utf-8') as parameters_file:
+    parameters = parameters_file.read()
+  match = re.search(r'relevant_entities\s*\{(.*?)\};', parameters, re.DOTALL)
+  if not match:
+    raise ValueError('relevant_entities not found in ' + path)
+  return set(
+      json.loads('"%s"' % name)
+      for name in re.findall(r'"((?:[^"\\]|\\.)*)"', match.group(1)))
+
+
+def _load_public_suffix_rules(path):
+  """Reads the rules of a Public Suffix List file such as
+  effective_tld_names.dat. Each rule is the first whitespace separated token
+  of its line, and lines starting with "//" are comments."""
+  rules = set()
+  with open(path, encoding='utf-8') as psl_file:
+    for line in psl_file:
+      tokens = line.split()
+      if not tokens or tokens[0].startswith('//'):
+        continue
+      rules.add(_rule_to_ascii(tokens[0]))
+  return rules
+
+
+def _rule_to_ascii(rule):
+  """Punycode-encodes internationalized rules, since that is how their hosts
+  appear in GURLs."""
+  prefix = ''
+  if rule.startswith('!'):
+    prefix, rule = '!', rule[1:]
+  rule = rule.lower()
+  if not rule.isascii():
+    rule = rule.encode('idna').decode('ascii')
+  return prefix + rule
+
+
+def _get_domain_and_registry(host, rules):
+  """Mirrors net::registry_controlled_domains::GetDomainAndRegistry() with
+  INCLUDE_PRIVATE_REGISTRIES: returns an empty string for IP addresses, hosts
+  with unknown registries and hosts that are registries themselves."""
+  host = host.lower().rstrip('.')
+  try:
+    ipaddress.ip_address(host)
+    return ''
+  except ValueError:
+    pass
+
+  labels = host.split('.')
+  registry_labels = 0
+  for i in range(len(labels)):
+    suffix = '.'.join(labels[i:])
+    if '!' + suffix in rules:
+      registry_labels = len(labels) - i - 1
+      break
+    wildcard = '.'.join(['*'] + labels[i + 1:])
+    if suffix in rules or (i + 1 < len(labels) and wildcard in rules):
+      registry_labels = len(labels) - i
+      break
+  if registry_labels == 0 or registry_labels >= len(labels):
+    return ''
+  return '.'.join(labels[-(registry_labels + 1):])
+
+
+def _build_mappings(entities, relevant_entities, rules):
+  entity_names = []
+  entity_index = {}
+  entity_by_domain = {}
+  entity_by_root_domain = {}
+
+  for entity in entities:
+    name = entity.get('name')
+    if not isinstance(name, str) or name not in relevant_entities:
+      continue
+    for domain in entity.get('domains', []):
+      if not isinstance(domain, str):
+        continue
+      if name not in entity_index:
+        entity_index[name] = len(entity_names)
+        entity_names.append(name)
+      index = entity_index[name]
+
+      entity_by_domain.setdefault(domain, index)
+
+      root_domain = _get_domain_and_registry(domain, rules)
+      if not root_domain:
+        continue
+      if entity_by_root_domain.get(root_domain, index) != index:
+        # If there is a clash at root domain level, neither is correct.
+        del entity_by_root_domain[root_domain]
+      else:
+        entity_by_root_domain[root_domain] = index
+
+  return entity_names, entity_by_domain, entity_by_root_domain
+
+
+def _hash(key, seed):
+  value = _FNV_OFFSET_BASIS ^ seed
+  for byte in key.encode('utf-8'):
+    value ^= byte
+    value = (value * _FNV_PRIME) & 0xffffffff
+  return value
+
+
+def _build_perfect_hash(mapping):
+  keys = sorted(mapping)
+  bucket_count = max(1, len(keys) // 2)
+  slot_count = max(1, len(keys) * 5 // 4)
+
+  buckets = [[] for _ in range(bucket_count)]
+  for key in keys:
+    buckets[_hash(key, 0) % bucket_count].append(key)
+
+  seeds = [0] * bucket_count
+  slots = [None] * slot_count
+  for bucket in sorted(range(bucket_count),
+                       key=lambda bucket: (-len(buckets[bucket]), bucket)):
+    if not buckets[bucket]:
+      continue
+    for seed in range(1, _MAX_SEED + 1):
+      candidate = [_hash(key, seed) % slot_count for key in buckets[bucket]]
+      if (len(set(candidate)) == len(candidate)
+          and all(slots[slot] is None for slot in candidate)):
+        break
+    else:
+      raise ValueError('Unable to build a perfect hash table')
+    seeds[bucket] = seed
+    for key, slot in zip(buckets[bucket], candidate):
+      slots[slot] = key
+
+  entries = [(key, mapping[key]) if key is not None else ('', _NO_ENTITY)
+             for key in slots]
+  return seeds, entries
+
+
+def _cpp_string(value):
+  escaped = ''
+  for byte in value.encode('utf-8'):
+    char = chr(byte)
+    if char in '"\\':
+      escaped += '\\' + char
+    elif 0x20 <= byte < 0x7f:
+      escaped += char
+    else:
+      escaped += '\\%03o' % byte
+  return '"%s"' % escaped
+
+
+def _generate_table(name, mapping):
+  seeds, entries = _build_perfect_hash(mapping)
+  lines = ['constexpr uint16_t k%sSeeds[] = {' % name]
+  lines += ['    %d,' % seed for seed in seeds]
+  lines += ['};', '', 'constexpr ThirdPartyTableEntry k%s[] = {' % name]
+  lines += [
+      '    {%s, %s},' %
+      (_cpp_string(key), 'kNoThirdPartyEntity' if index == _NO_ENTITY else
+       str(index)) for key, index in entries
+  ]
+  lines += ['};', '']
+  return lines
+
+
+def _generate(entity_names, domains, root_domains):
+  lines = [
+      '// Generated by generate_named_third_party_table.py. Do not edit.',
+      '',
+      'constexpr base::StringPiece kThirdPartyEntityNames[] = {',
+  ]
+  lines += ['    %s,' % _cpp_string(name) for name in entity_names]
+  lines += ['};', '']
+  lines += _generate_table('ThirdPartyDomains', domains)
+  lines += _generate_table('ThirdPartyRootDomains', root_domains)
+  return '\n'.join(lines)
+
+
+if __name__ == '__main__':
+  main()
@@ -0,0 +1,139 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/https_everywhere_ruleset.h"
+
+#include <utility>
+
+#include "base/json/json_reader.h"
+#include "base/memory/ptr_util.h"
+#include "base/values.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+#include "third_party/re2/src/re2/re2.h"
+
+namespace brave_shields {
+
+namespace {
+
+// The rules database uses $1 style back references, RE2 expects \1.
+std::string CorrectToRuleToRE2Engine(const std::string& to) {
+  std::string corrected_to(to);
+  size_t pos = corrected_to.find('$');
+  while (std::string::npos != pos) {
+    corrected_to[pos] = '\\';
+    pos = corrected_to.find('$', pos + 1);
+  }
+  return corrected_to;
+}
+
+}  // namespace
+
+HTTPSEverywhereRuleset::Rewrite::Rewrite() = default;
+HTTPSEverywhereRuleset::Rewrite::Rewrite(Rewrite&&) = default;
+HTTPSEverywhereRuleset::Rewrite& HTTPSEverywhereRuleset::Rewrite::operator=(
+    Rewrite&&) = default;
+HTTPSEverywhereRuleset::Rewrite::~Rewrite() = default;
+
+HTTPSEverywhereRuleset::Rule::Rule() = default;
+HTTPSEverywhereRuleset::Rule::Rule(Rule&&) = default;
+HTTPSEverywhereRuleset::Rule& HTTPSEverywhereRuleset::Rule::operator=(Rule&&) =
+    default;
+HTTPSEverywhereRuleset::Rule::~Rule() = default;
+
+HTTPSEverywhereRuleset::HTTPSEverywhereRuleset() = default;
+
+HTTPSEverywhereRuleset::~HTTPSEverywhereRuleset() = default;
+
+// static
+std::unique_ptr<HTTPSEverywhereRuleset> HTTPSEverywhereRuleset::Parse(
+    const std::string& json) {
+  absl::optional<base::Value> json_object = base::JSONReader::Read(json);
+  if (!json_object || !json_object->is_list()) {
+    return nullptr;
+  }
+
+  auto ruleset = base::WrapUnique(new HTTPSEverywhereRuleset());
+  for (const auto& top_value : json_object->GetList()) {
+    const base::Value::Dict* top_dict = top_value.GetIfDict();
+    if (!top_dict) {
+      continue;
+    }
+
+    Rule rule;
+    if (const base::Value::List* exclusions = top_dict->FindList("e")) {
+      for (const auto& exclusion : *exclusions) {
+        const base::Value::Dict* exclusion_dict = exclusion.GetIfDict();
+        if (!exclusion_dict) {
+          continue;
+        }
+        const std::string* pattern = exclusion_dict->FindString("p");
+        if (!pattern) {
+          continue;
+        }
+        rule.exclusions.push_back(std::make_unique<re2::RE2>(
+            CorrectToRuleToRE2Engine(*pattern), re2::RE2::Quiet));
+      }
+    }
+
+    if (const base::Value::List* rewrites = top_dict->FindList("r")) {
+      rule.has_rewrites = true;
+      for (const auto& rewrite_value : *rewrites) {
+        const base::Value::Dict* rewrite_dict = rewrite_value.GetIfDict();
+        if (!rewrite_dict) {
+          continue;
+        }
+
+        Rewrite rewrite;
+        if (rewrite_dict->Find("d")) {
+          rewrite.upgrade_scheme = true;
+          rule.rewrites.push_back(std::move(rewrite));
+          continue;
+        }
+
+        const std::string* from = rewrite_dict->FindString("f");
+        const std::string* to = rewrite_dict->FindString("t");
+        if (!from || !to) {
+          continue;
+        }
+        rewrite.from = std::make_unique<re2::RE2>(*from, re2::RE2::Quiet);
+        rewrite.to = CorrectToRuleToRE2Engine(*to);
+        rule.rewrites.push_back(std::move(rewrite));
+      }
+    }
+
+    ruleset->rules_.push_back(std::move(rule));
+  }
+
+  return ruleset;
+}
+
+std::string HTTPSEverywhereRuleset::Apply(const std::string& url) const {
+  for (const auto& rule : rules_) {
+    for (const auto& exclusion : rule.exclusions) {
+      if (re2::RE2::FullMatch(url, *exclusion)) {
+        return "";
+      }
+    }
+
+    if (!rule.has_rewrites) {
+      return "";
+    }
+
+    for (const auto& rewrite : rule.rewrites) {
+      std::string new_url(url);
+      if (rewrite.upgrade_scheme) {
+        return new_url.insert(4, "s");
+      }
+
+      if (re2::RE2::Replace(&new_url, *rewrite.from, rewrite.to) &&
+          new_url != url) {
+        return new_url;
+      }
+    }
+  }
+  return "";
+}
+
+}  // namespace brave_shields
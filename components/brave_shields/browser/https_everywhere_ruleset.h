@@ -0,0 +1,67 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_HTTPS_EVERYWHERE_RULESET_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_HTTPS_EVERYWHERE_RULESET_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace re2 {
+class RE2;
+}  // namespace re2
+
+namespace brave_shields {
+
+// A HTTPS Everywhere ruleset as stored in the rules database, parsed once with
+// all of its exclusion and rewrite patterns precompiled.
+class HTTPSEverywhereRuleset {
+ public:
+  HTTPSEverywhereRuleset(const HTTPSEverywhereRuleset&) = delete;
+  HTTPSEverywhereRuleset& operator=(const HTTPSEverywhereRuleset&) = delete;
+  ~HTTPSEverywhereRuleset();
+
+  // Returns nullptr if |json| is not a list of rules.
+  static std::unique_ptr<HTTPSEverywhereRuleset> Parse(
+      const std::string& json);
+
+  // Returns the rewritten URL, or an empty string if |url| should not be
+  // rewritten.
+  std::string Apply(const std::string& url) const;
+
+ private:
+  struct Rewrite {
+    Rewrite();
+    Rewrite(Rewrite&&);
+    Rewrite& operator=(Rewrite&&);
+    ~Rewrite();
+
+    // Set for the "d" (default) rule which upgrades the scheme only.
+    bool upgrade_scheme = false;
+    std::unique_ptr<re2::RE2> from;
+    std::string to;
+  };
+
+  struct Rule {
+    Rule();
+    Rule(Rule&&);
+    Rule& operator=(Rule&&);
+    ~Rule();
+
+    std::vector<std::unique_ptr<re2::RE2>> exclusions;
+    // False if the rule has no valid "r" list, which stops the lookup.
+    bool has_rewrites = false;
+    std::vector<Rewrite> rewrites;
+  };
+
+  HTTPSEverywhereRuleset();
+
+  std::vector<Rule> rules_;
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_HTTPS_EVERYWHERE_RULESET_H_
@@ -0,0 +1,61 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/https_everywhere_ruleset.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_shields {
+
+TEST(HTTPSEverywhereRulesetTest, InvalidJson) {
+  EXPECT_FALSE(HTTPSEverywhereRuleset::Parse("not json"));
+  EXPECT_FALSE(HTTPSEverywhereRuleset::Parse(R"({"r": []})"));
+}
+
+TEST(HTTPSEverywhereRulesetTest, DefaultRuleUpgradesScheme) {
+  const auto ruleset =
+      HTTPSEverywhereRuleset::Parse(R"([{"r": [{"d": 1}]}])");
+  ASSERT_TRUE(ruleset);
+  EXPECT_EQ("https://example.com/", ruleset->Apply("http://example.com/"));
+}
+
+TEST(HTTPSEverywhereRulesetTest, RewriteWithBackReferences) {
+  const auto ruleset = HTTPSEverywhereRuleset::Parse(
+      R"([{"r": [{"f": "^http://(www\\.)?example\\.com/",
+                  "t": "https://$1example.com/"}]}])");
+  ASSERT_TRUE(ruleset);
+  EXPECT_EQ("https://www.example.com/path",
+            ruleset->Apply("http://www.example.com/path"));
+  EXPECT_EQ("https://example.com/", ruleset->Apply("http://example.com/"));
+  EXPECT_EQ("", ruleset->Apply("http://other.com/"));
+}
+
+TEST(HTTPSEverywhereRulesetTest, Exclusions) {
+  const auto ruleset = HTTPSEverywhereRuleset::Parse(
+      R"([{"e": [{"p": "^http://example\\.com/insecure/.*"}],
+           "r": [{"d": 1}]}])");
+  ASSERT_TRUE(ruleset);
+  EXPECT_EQ("", ruleset->Apply("http://example.com/insecure/page"));
+  EXPECT_EQ("https://example.com/secure",
+            ruleset->Apply("http://example.com/secure"));
+}
+
+TEST(HTTPSEverywhereRulesetTest, RuleWithoutRewritesStopsLookup) {
+  const auto ruleset =
+      HTTPSEverywhereRuleset::Parse(R"([{"e": []}, {"r": [{"d": 1}]}])");
+  ASSERT_TRUE(ruleset);
+  EXPECT_EQ("", ruleset->Apply("http://example.com/"));
+}
+
+TEST(HTTPSEverywhereRulesetTest, FallsThroughToNextRule) {
+  const auto ruleset = HTTPSEverywhereRuleset::Parse(
+      R"([{"r": [{"f": "^http://nomatch\\.com/", "t": "https://nomatch.com/"}]},
+          {"r": [{"f": "^http://example\\.com/", "t": "https://example.com/"}]}
+         ])");
+  ASSERT_TRUE(ruleset);
+  EXPECT_EQ("https://example.com/", ruleset->Apply("http://example.com/"));
+}
+
+}  // namespace brave_shields
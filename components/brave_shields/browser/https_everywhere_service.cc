@@ -13,15 +13,12 @@
 #include "base/base_paths.h"
 #include "base/files/file_util.h"
 #include "base/functional/bind.h"
-#include "base/json/json_reader.h"
 #include "base/logging.h"
 #include "base/memory/ptr_util.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/threading/scoped_blocking_call.h"
-#include "base/values.h"
 #include "third_party/leveldatabase/src/include/leveldb/db.h"
-#include "third_party/re2/src/re2/re2.h"
 #include "third_party/zlib/google/zip.h"
 
 #define DAT_FILE "httpse.leveldb.zip"
@@ -31,6 +28,9 @@
 
 namespace {
 
+// Number of compiled rulesets, keyed by lookup domain, kept in memory.
+constexpr size_t kRulesetsCacheSize = 1000;
+
 std::vector<std::string> Split(const std::string& s, char delim) {
   std::stringstream ss(s);
   std::string item;
@@ -81,7 +81,9 @@ std::string leveldbGet(leveldb::DB* db, const std::string &key) {
 namespace brave_shields {
 
 HTTPSEverywhereService::Engine::Engine(HTTPSEverywhereService* service)
-    : level_db_(nullptr), service_(service) {
+    : level_db_(nullptr),
+      rulesets_(kRulesetsCacheSize),
+      service_(service) {
   DETACH_FROM_SEQUENCE(sequence_checker_);
 }
 
@@ -154,10 +156,10 @@ bool HTTPSEverywhereService::Engine::GetHTTPSURL(
   SCOPED_UMA_HISTOGRAM_TIMER("Brave.HTTPSE.GetHTTPSURL");
   const std::vector<std::string> domains =
       ExpandDomainForLookup(candidate_url.host());
-  for (auto domain : domains) {
-    std::string value = leveldbGet(level_db_, domain);
-    if (!value.empty()) {
-      *new_url = ApplyHTTPSRule(candidate_url.spec(), value);
+  for (const auto& domain : domains) {
+    const HTTPSEverywhereRuleset* ruleset = GetRuleset(domain);
+    if (ruleset) {
+      *new_url = ruleset->Apply(candidate_url.spec());
       if (0 != new_url->length()) {
         service_->recently_used_cache().add(candidate_url.spec(), *new_url);
         service_->AddHTTPSEUrlToRedirectList(request_identifier);
@@ -169,104 +171,21 @@ bool HTTPSEverywhereService::Engine::GetHTTPSURL(
   return false;
 }
 
-std::string HTTPSEverywhereService::Engine::ApplyHTTPSRule(
-    const std::string& originalUrl,
-    const std::string& rule) {
-  absl::optional<base::Value> json_object = base::JSONReader::Read(rule);
-  if (absl::nullopt == json_object || !json_object->is_list()) {
-    return "";
-  }
-
-  const base::Value::List& topValues = json_object->GetList();
-  for (const auto& topValue : topValues) {
-    if (!topValue.is_dict()) {
-      continue;
-    }
-    const base::Value::Dict* childTopDictionary = topValue.GetIfDict();
-    if (nullptr == childTopDictionary) {
-      continue;
-    }
-
-    const base::Value* exclusion = childTopDictionary->Find("e");
-    if (nullptr != exclusion) {
-      const base::Value::List* eValues = exclusion->GetIfList();
-      if (nullptr != eValues) {
-        for (const auto& eValue : *eValues) {
-          const base::Value::Dict* pDictionary = eValue.GetIfDict();
-          if (nullptr == pDictionary) {
-            continue;
-          }
-          const base::Value* patternValue = pDictionary->Find("p");
-          if (!patternValue) {
-            continue;
-          }
-          if (!patternValue->is_string()) {
-            continue;
-          }
-          std::string pattern =
-              CorrecttoRuleToRE2Engine(patternValue->GetString());
-          if (RE2::FullMatch(originalUrl, pattern)) {
-            return "";
-          }
-        }
-      }
-    }
-
-    const base::Value* rules = childTopDictionary->Find("r");
-    if (!rules) {
-      return "";
-    }
-    const base::Value::List* rValues = rules->GetIfList();
-    if (nullptr == rValues) {
-      return "";
-    }
-
-    for (const auto& rValue : *rValues) {
-      const base::Value::Dict* pDictionary = rValue.GetIfDict();
-      if (nullptr == pDictionary) {
-        continue;
-      }
-      const base::Value* patternValue = pDictionary->Find("d");
-      if (patternValue) {
-        std::string newUrl(originalUrl);
-        return newUrl.insert(4, "s");
-      }
-
-      const base::Value* from_value = pDictionary->Find("f");
-      const base::Value* to_value = pDictionary->Find("t");
-      if (!from_value || !to_value) {
-        continue;
-      }
-      if (!from_value->is_string() || !to_value->is_string()) {
-        continue;
-      }
-
-      std::string to = CorrecttoRuleToRE2Engine(to_value->GetString());
-      std::string newUrl(originalUrl);
-      RE2 regExp(from_value->GetString());
-
-      if (RE2::Replace(&newUrl, regExp, to) && newUrl != originalUrl) {
-        return newUrl;
-      }
-    }
-  }
-  return "";
-}
-
-std::string HTTPSEverywhereService::Engine::CorrecttoRuleToRE2Engine(
-    const std::string& to) {
-  std::string correctedto(to);
-  size_t pos = to.find("$");
-  while (std::string::npos != pos) {
-    correctedto[pos] = '\\';
-    pos = correctedto.find("$");
+const HTTPSEverywhereRuleset* HTTPSEverywhereService::Engine::GetRuleset(
+    const std::string& key) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  auto it = rulesets_.Get(key);
+  if (it == rulesets_.end()) {
+    const std::string value = leveldbGet(level_db_, key);
+    it = rulesets_.Put(
+        key, value.empty() ? nullptr : HTTPSEverywhereRuleset::Parse(value));
   }
-
-  return correctedto;
+  return it->second.get();
 }
 
 void HTTPSEverywhereService::Engine::CloseDatabase() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  rulesets_.Clear();
   if (level_db_) {
     delete level_db_;
     level_db_ = nullptr;
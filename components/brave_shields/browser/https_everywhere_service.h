@@ -10,12 +10,14 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/lru_cache.h"
 #include "base/files/file_path.h"
 #include "base/memory/weak_ptr.h"
 #include "base/sequence_checker.h"
 #include "base/synchronization/lock.h"
 #include "brave/components/brave_shields/browser/base_brave_shields_service.h"
 #include "brave/components/brave_shields/browser/https_everywhere_recently_used_cache.h"
+#include "brave/components/brave_shields/browser/https_everywhere_ruleset.h"
 
 namespace leveldb {
 class DB;
@@ -63,12 +65,14 @@ class HTTPSEverywhereService : public BaseBraveShieldsService {
                      std::string* new_url);
 
    private:
-    std::string ApplyHTTPSRule(const std::string& originalUrl,
-                               const std::string& rule);
-    std::string CorrecttoRuleToRE2Engine(const std::string& to);
+    // Returns the compiled ruleset stored under |key|, or nullptr if there is
+    // none. Lookups, including misses, are cached.
+    const HTTPSEverywhereRuleset* GetRuleset(const std::string& key);
     void CloseDatabase();
 
     leveldb::DB* level_db_;
+    base::LRUCache<std::string, std::unique_ptr<HTTPSEverywhereRuleset>>
+        rulesets_;
     HTTPSEverywhereService* service_;  // not owned
     SEQUENCE_CHECKER(sequence_checker_);
   };
@@ -0,0 +1,99 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/shields_settings_cache.h"
+
+#include "base/check.h"
+#include "url/gurl.h"
+
+namespace brave_shields {
+
+namespace {
+
+constexpr size_t kMaxCachedOrigins = 100;
+
+constexpr ContentSettingsType kShieldsContentSettingsTypes[] = {
+    ContentSettingsType::BRAVE_SHIELDS,
+    ContentSettingsType::BRAVE_ADS,
+    ContentSettingsType::BRAVE_TRACKERS,
+    ContentSettingsType::BRAVE_COSMETIC_FILTERING,
+    ContentSettingsType::BRAVE_HTTP_UPGRADABLE_RESOURCES,
+    ContentSettingsType::BRAVE_REFERRERS,
+};
+
+bool AffectsShieldsSettings(ContentSettingsTypeSet content_type_set) {
+  if (content_type_set.ContainsAllTypes()) {
+    return true;
+  }
+  for (auto type : kShieldsContentSettingsTypes) {
+    if (content_type_set.Contains(type)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+ShieldsSettingsCache::ShieldsSettingsCache(HostContentSettingsMap* map)
+    : map_(map), settings_(kMaxCachedOrigins) {
+  DCHECK(map_);
+  observation_.Observe(map_.get());
+}
+
+ShieldsSettingsCache::~ShieldsSettingsCache() = default;
+
+// static
+ShieldsSettings ShieldsSettingsCache::ComputeSettings(
+    HostContentSettingsMap* map,
+    const GURL& url) {
+  ShieldsSettings settings;
+  settings.shields_enabled = GetBraveShieldsEnabled(map, url);
+  settings.ad_control_type = GetAdControlType(map, url);
+  settings.cosmetic_filtering_control_type =
+      GetCosmeticFilteringControlType(map, url);
+  settings.https_everywhere_enabled = GetHTTPSEverywhereEnabled(map, url);
+  settings.referrers_allowed = AreReferrersAllowed(map, url);
+  return settings;
+}
+
+ShieldsSettings ShieldsSettingsCache::GetSettings(const GURL& url) {
+  DCHECK_CALLING_ON_SEQUENCE(sequence_checker_);
+  // Content settings for other schemes may depend on more than the origin.
+  if (!url.SchemeIsHTTPOrHTTPS()) {
+    return ComputeSettings(map_.get(), url);
+  }
+
+  const url::Origin origin = url::Origin::Create(url);
+  auto it = settings_.Get(origin);
+  if (it != settings_.end()) {
+    return it->second;
+  }
+
+  const ShieldsSettings settings = ComputeSettings(map_.get(), url);
+  settings_.Put(origin, settings);
+  return settings;
+}
+
+void ShieldsSettingsCache::Shutdown() {
+  DCHECK_CALLING_ON_SEQUENCE(sequence_checker_);
+  observation_.Reset();
+  settings_.Clear();
+  map_ = nullptr;
+}
+
+void ShieldsSettingsCache::OnContentSettingChanged(
+    const ContentSettingsPattern& primary_pattern,
+    const ContentSettingsPattern& secondary_pattern,
+    ContentSettingsTypeSet content_type_set) {
+  DCHECK_CALLING_ON_SEQUENCE(sequence_checker_);
+  if (!AffectsShieldsSettings(content_type_set)) {
+    return;
+  }
+  settings_.Clear();
+  ++generation_;
+}
+
+}  // namespace brave_shields
@@ -0,0 +1,76 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_SETTINGS_CACHE_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_SETTINGS_CACHE_H_
+
+#include <stdint.h>
+
+#include "base/containers/lru_cache.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/scoped_observation.h"
+#include "base/sequence_checker.h"
+#include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "components/content_settings/core/browser/content_settings_observer.h"
+#include "components/content_settings/core/browser/host_content_settings_map.h"
+#include "components/keyed_service/core/keyed_service.h"
+#include "url/origin.h"
+
+class GURL;
+
+namespace brave_shields {
+
+// Effective Shields settings of a single origin, as computed by the
+// brave_shields::Get* helpers.
+struct ShieldsSettings {
+  bool shields_enabled = true;
+  ControlType ad_control_type = ControlType::BLOCK;
+  ControlType cosmetic_filtering_control_type = ControlType::BLOCK_THIRD_PARTY;
+  bool https_everywhere_enabled = true;
+  bool referrers_allowed = false;
+};
+
+// Caches ShieldsSettings per origin so that request-path code doesn't have to
+// walk the content settings patterns for every setting of every request. The
+// whole cache is dropped whenever a Shields content setting changes.
+class ShieldsSettingsCache : public KeyedService,
+                             public content_settings::Observer {
+ public:
+  explicit ShieldsSettingsCache(HostContentSettingsMap* map);
+  ShieldsSettingsCache(const ShieldsSettingsCache&) = delete;
+  ShieldsSettingsCache& operator=(const ShieldsSettingsCache&) = delete;
+  ~ShieldsSettingsCache() override;
+
+  // Computes the settings for |url| from |map|, without any caching.
+  static ShieldsSettings ComputeSettings(HostContentSettingsMap* map,
+                                         const GURL& url);
+
+  ShieldsSettings GetSettings(const GURL& url);
+
+  // Incremented each time cached settings are invalidated.
+  uint64_t generation() const { return generation_; }
+
+  // KeyedService:
+  void Shutdown() override;
+
+  // content_settings::Observer:
+  void OnContentSettingChanged(
+      const ContentSettingsPattern& primary_pattern,
+      const ContentSettingsPattern& secondary_pattern,
+      ContentSettingsTypeSet content_type_set) override;
+
+ private:
+  scoped_refptr<HostContentSettingsMap> map_;
+  base::LRUCache<url::Origin, ShieldsSettings> settings_;
+  uint64_t generation_ = 0;
+  base::ScopedObservation<HostContentSettingsMap, content_settings::Observer>
+      observation_{this};
+
+  SEQUENCE_CHECKER(sequence_checker_);
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_SETTINGS_CACHE_H_
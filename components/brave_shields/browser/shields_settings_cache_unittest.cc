@@ -0,0 +1,109 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/shields_settings_cache.h"
+
+#include <memory>
+
+#include "base/files/scoped_temp_dir.h"
+#include "base/memory/raw_ptr.h"
+#include "brave/browser/profiles/brave_profile_manager.h"
+#include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "chrome/browser/browser_process.h"
+#include "chrome/browser/content_settings/host_content_settings_map_factory.h"
+#include "chrome/test/base/scoped_testing_local_state.h"
+#include "chrome/test/base/testing_browser_process.h"
+#include "chrome/test/base/testing_profile.h"
+#include "components/content_settings/core/browser/host_content_settings_map.h"
+#include "components/content_settings/core/common/content_settings_types.h"
+#include "content/public/test/browser_task_environment.h"
+#include "content/public/test/test_utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace brave_shields {
+
+class ShieldsSettingsCacheTest : public testing::Test {
+ public:
+  ShieldsSettingsCacheTest()
+      : local_state_(TestingBrowserProcess::GetGlobal()) {}
+  ShieldsSettingsCacheTest(const ShieldsSettingsCacheTest&) = delete;
+  ShieldsSettingsCacheTest& operator=(const ShieldsSettingsCacheTest&) =
+      delete;
+  ~ShieldsSettingsCacheTest() override = default;
+
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    TestingBrowserProcess::GetGlobal()->SetProfileManager(
+        std::make_unique<BraveProfileManagerWithoutInit>(temp_dir_.GetPath()));
+    TestingProfile::Builder builder;
+    builder.SetPath(temp_dir_.GetPath());
+    profile_ = builder.Build();
+    g_browser_process->profile_manager()->InitProfileUserPrefs(profile_.get());
+    map_ = HostContentSettingsMapFactory::GetForProfile(profile_.get());
+  }
+
+  void TearDown() override {
+    map_ = nullptr;
+    profile_.reset();
+    TestingBrowserProcess::GetGlobal()->SetProfileManager(nullptr);
+    content::RunAllTasksUntilIdle();
+  }
+
+  HostContentSettingsMap* map() { return map_; }
+
+ private:
+  base::ScopedTempDir temp_dir_;
+  content::BrowserTaskEnvironment task_environment_;
+  std::unique_ptr<TestingProfile> profile_;
+  ScopedTestingLocalState local_state_;
+  raw_ptr<HostContentSettingsMap> map_ = nullptr;
+};
+
+TEST_F(ShieldsSettingsCacheTest, GetSettings) {
+  ShieldsSettingsCache cache(map());
+  const GURL url("http://brave.com");
+
+  EXPECT_TRUE(cache.GetSettings(url).shields_enabled);
+  EXPECT_EQ(ControlType::BLOCK, cache.GetSettings(url).ad_control_type);
+  EXPECT_EQ(0u, cache.generation());
+
+  cache.Shutdown();
+}
+
+TEST_F(ShieldsSettingsCacheTest, ShieldsSettingChangeInvalidatesCache) {
+  ShieldsSettingsCache cache(map());
+  const GURL url("http://brave.com");
+  EXPECT_TRUE(cache.GetSettings(url).shields_enabled);
+
+  SetBraveShieldsEnabled(map(), false, url);
+  EXPECT_LT(0u, cache.generation());
+  EXPECT_FALSE(cache.GetSettings(url).shields_enabled);
+  EXPECT_TRUE(cache.GetSettings(GURL("http://example.com")).shields_enabled);
+
+  cache.Shutdown();
+}
+
+TEST_F(ShieldsSettingsCacheTest, OtherSettingChangeKeepsCache) {
+  ShieldsSettingsCache cache(map());
+  const GURL url("http://brave.com");
+  EXPECT_TRUE(cache.GetSettings(url).shields_enabled);
+
+  map()->SetContentSettingDefaultScope(
+      url, GURL(), ContentSettingsType::JAVASCRIPT, CONTENT_SETTING_BLOCK);
+  EXPECT_EQ(0u, cache.generation());
+
+  cache.Shutdown();
+}
+
+TEST_F(ShieldsSettingsCacheTest, NonHttpSettingsAreComputed) {
+  ShieldsSettingsCache cache(map());
+
+  EXPECT_FALSE(cache.GetSettings(GURL("chrome://preferences")).shields_enabled);
+
+  cache.Shutdown();
+}
+
+}  // namespace brave_shields
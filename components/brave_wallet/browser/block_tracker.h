@@ -22,6 +22,7 @@ class BlockTracker {
   virtual void Start(base::TimeDelta interval) = 0;
   virtual void Stop();
   bool IsRunning() const;
+  base::TimeDelta GetInterval() const;
 
  protected:
   base::RepeatingTimer timer_;
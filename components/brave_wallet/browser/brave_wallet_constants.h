@@ -1220,7 +1220,14 @@ constexpr char kSolanaFeeRecipient[] =
     "3NUW8hWoCnLgJwWCVnwdFo2Dsz8bKwLac9A3VgS2jLUQ";
 
 constexpr int64_t kBlockTrackerDefaultTimeInSeconds = 20;
+// Pending transactions that haven't changed status for this many block
+// tracker checks are polled every kBlockTrackerBackoffTimeInSeconds instead.
+constexpr int kBlockTrackerChecksBeforeBackoff = 15;
+constexpr int64_t kBlockTrackerBackoffTimeInSeconds = 60;
 constexpr int64_t kLogTrackerDefaultTimeInSeconds = 20;
+// After a network fails to answer a JSON-RPC batch request, requests to it are
+// sent one by one for this long before batching is tried again.
+constexpr int64_t kJsonRpcBatchBackoffTimeInMinutes = 10;
 
 constexpr char kPolygonMainnetEndpoint[] = "https://mainnet-polygon.brave.com/";
 
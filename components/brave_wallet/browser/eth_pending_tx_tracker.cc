@@ -5,6 +5,7 @@
 
 #include "brave/components/brave_wallet/browser/eth_pending_tx_tracker.h"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -19,6 +20,14 @@
 
 namespace brave_wallet {
 
+namespace {
+
+// Upper bound on the receipts fetched by a single batch request, as RPC
+// providers limit the size of batches.
+constexpr size_t kMaxTxReceiptsPerBatch = 50;
+
+}  // namespace
+
 EthPendingTxTracker::EthPendingTxTracker(EthTxStateManager* tx_state_manager,
                                          JsonRpcService* json_rpc_service,
                                          EthNonceTracker* nonce_tracker)
@@ -41,16 +50,25 @@ bool EthPendingTxTracker::UpdatePendingTransactions(size_t* num_pending) {
       pending_transactions.end(),
       std::make_move_iterator(signed_transactions.begin()),
       std::make_move_iterator(signed_transactions.end()));
+  std::vector<std::string> ids;
+  std::vector<std::string> tx_hashes;
   for (const auto& pending_transaction : pending_transactions) {
     if (IsNonceTaken(static_cast<const EthTxMeta&>(*pending_transaction))) {
       DropTransaction(pending_transaction.get());
       continue;
     }
-    std::string id = pending_transaction->id();
-    json_rpc_service_->GetTransactionReceipt(
-        pending_transaction->tx_hash(),
-        base::BindOnce(&EthPendingTxTracker::OnGetTxReceipt,
-                       weak_factory_.GetWeakPtr(), std::move(id)));
+    ids.push_back(pending_transaction->id());
+    tx_hashes.push_back(pending_transaction->tx_hash());
+  }
+  for (size_t begin = 0; begin < ids.size(); begin += kMaxTxReceiptsPerBatch) {
+    const size_t end = std::min(begin + kMaxTxReceiptsPerBatch, ids.size());
+    json_rpc_service_->GetTransactionReceipts(
+        std::vector<std::string>(tx_hashes.begin() + begin,
+                                 tx_hashes.begin() + end),
+        base::BindOnce(&EthPendingTxTracker::OnGetTxReceipts,
+                       weak_factory_.GetWeakPtr(),
+                       std::vector<std::string>(ids.begin() + begin,
+                                                ids.begin() + end)));
   }
 
   nonce_lock->Release();
@@ -80,28 +98,37 @@ void EthPendingTxTracker::Reset() {
   dropped_blocks_counter_.clear();
 }
 
-void EthPendingTxTracker::OnGetTxReceipt(std::string id,
-                                         TransactionReceipt receipt,
-                                         mojom::ProviderError error,
-                                         const std::string& error_message) {
-  if (error != mojom::ProviderError::kSuccess)
-    return;
+void EthPendingTxTracker::OnGetTxReceipts(
+    std::vector<std::string> ids,
+    std::vector<absl::optional<TransactionReceipt>> receipts) {
+  DCHECK_EQ(ids.size(), receipts.size());
   base::Lock* nonce_lock = nonce_tracker_->GetLock();
   if (!nonce_lock->Try())
     return;
 
-  std::unique_ptr<EthTxMeta> meta = tx_state_manager_->GetEthTx(id);
-  if (!meta) {
-    nonce_lock->Release();
-    return;
+  std::vector<std::unique_ptr<EthTxMeta>> confirmed_metas;
+  for (size_t i = 0; i < ids.size(); ++i) {
+    if (!receipts[i])
+      continue;
+    std::unique_ptr<EthTxMeta> meta = tx_state_manager_->GetEthTx(ids[i]);
+    if (!meta)
+      continue;
+    if (receipts[i]->status) {
+      meta->set_tx_receipt(*receipts[i]);
+      meta->set_status(mojom::TransactionStatus::Confirmed);
+      meta->set_confirmed_time(base::Time::Now());
+      confirmed_metas.push_back(std::move(meta));
+    } else if (ShouldTxDropped(*meta)) {
+      DropTransaction(meta.get());
+    }
   }
-  if (receipt.status) {
-    meta->set_tx_receipt(receipt);
-    meta->set_status(mojom::TransactionStatus::Confirmed);
-    meta->set_confirmed_time(base::Time::Now());
-    tx_state_manager_->AddOrUpdateTx(*meta);
-  } else if (ShouldTxDropped(*meta)) {
-    DropTransaction(meta.get());
+
+  if (!confirmed_metas.empty()) {
+    std::vector<const TxMeta*> metas;
+    for (const auto& meta : confirmed_metas) {
+      metas.push_back(meta.get());
+    }
+    tx_state_manager_->AddOrUpdateTxs(metas);
   }
 
   nonce_lock->Release();
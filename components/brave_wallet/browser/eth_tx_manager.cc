@@ -911,6 +911,7 @@ std::unique_ptr<EthTxMeta> EthTxManager::GetTxForTesting(
 }
 
 void EthTxManager::OnNewBlock(uint256_t block_num) {
+  OnBlockTrackerPolled();
   UpdatePendingTransactions();
 }
 
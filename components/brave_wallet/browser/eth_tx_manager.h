@@ -149,6 +149,8 @@ class EthTxManager : public TxManager, public EthBlockTracker::Observer {
   FRIEND_TEST_ALL_PREFIXES(EthTxManagerUnitTest, TestSubmittedToConfirmed);
   FRIEND_TEST_ALL_PREFIXES(EthTxManagerUnitTest, RetryTransaction);
   FRIEND_TEST_ALL_PREFIXES(EthTxManagerUnitTest, Reset);
+  FRIEND_TEST_ALL_PREFIXES(EthTxManagerUnitTest, BlockTrackerInterval);
+  FRIEND_TEST_ALL_PREFIXES(EthTxManagerUnitTest, BlockTrackerBackoffBoundary);
   friend class EthTxManagerUnitTest;
 
   void AddUnapprovedTransaction(mojom::TxDataPtr tx_data,
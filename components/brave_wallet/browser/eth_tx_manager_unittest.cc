@@ -2221,4 +2221,98 @@ TEST_F(EthTxManagerUnitTest, Reset) {
   EXPECT_FALSE(GetPrefs()->HasPrefPath(kBraveWalletTransactions));
 }
 
+TEST_F(EthTxManagerUnitTest, BlockTrackerInterval) {
+  auto* block_tracker = eth_tx_manager()->block_tracker_.get();
+
+  // Nothing to poll for.
+  eth_tx_manager()->known_no_pending_tx_ = true;
+  eth_tx_manager()->CheckIfBlockTrackerShouldRun();
+  EXPECT_FALSE(block_tracker->IsRunning());
+
+  eth_tx_manager()->known_no_pending_tx_ = false;
+  eth_tx_manager()->CheckIfBlockTrackerShouldRun();
+  EXPECT_TRUE(block_tracker->IsRunning());
+  EXPECT_EQ(base::Seconds(kBlockTrackerDefaultTimeInSeconds),
+            block_tracker->GetInterval());
+
+  // Re-checking whether the tracker should run is not a poll.
+  for (int i = 0; i <= kBlockTrackerChecksBeforeBackoff; ++i) {
+    eth_tx_manager()->CheckIfBlockTrackerShouldRun();
+  }
+  EXPECT_EQ(base::Seconds(kBlockTrackerDefaultTimeInSeconds),
+            block_tracker->GetInterval());
+
+  // Transactions that stay pending are checked less often.
+  for (int i = 0; i < kBlockTrackerChecksBeforeBackoff; ++i) {
+    EXPECT_EQ(base::Seconds(kBlockTrackerDefaultTimeInSeconds),
+              block_tracker->GetInterval());
+    eth_tx_manager()->OnBlockTrackerPolled();
+    eth_tx_manager()->CheckIfBlockTrackerShouldRun();
+  }
+  EXPECT_TRUE(block_tracker->IsRunning());
+  EXPECT_EQ(base::Seconds(kBlockTrackerBackoffTimeInSeconds),
+            block_tracker->GetInterval());
+
+  tx_service_->Reset();
+  EXPECT_FALSE(block_tracker->IsRunning());
+  eth_tx_manager()->CheckIfBlockTrackerShouldRun();
+  EXPECT_EQ(base::Seconds(kBlockTrackerDefaultTimeInSeconds),
+            block_tracker->GetInterval());
+}
+
+TEST_F(EthTxManagerUnitTest, BlockTrackerBackoffBoundary) {
+  auto* block_tracker = eth_tx_manager()->block_tracker_.get();
+  eth_tx_manager()->known_no_pending_tx_ = false;
+  eth_tx_manager()->CheckIfBlockTrackerShouldRun();
+  ASSERT_TRUE(block_tracker->IsRunning());
+  const auto initial_stats = eth_tx_manager()->block_tracker_stats();
+
+  // One poll short of the threshold keeps the default interval.
+  for (int i = 0; i < kBlockTrackerChecksBeforeBackoff - 1; ++i) {
+    eth_tx_manager()->OnBlockTrackerPolled();
+    eth_tx_manager()->CheckIfBlockTrackerShouldRun();
+  }
+  EXPECT_EQ(base::Seconds(kBlockTrackerDefaultTimeInSeconds),
+            block_tracker->GetInterval());
+  EXPECT_EQ(initial_stats.polls + kBlockTrackerChecksBeforeBackoff - 1,
+            eth_tx_manager()->block_tracker_stats().polls);
+  EXPECT_EQ(initial_stats.backoffs,
+            eth_tx_manager()->block_tracker_stats().backoffs);
+
+  // The poll reaching the threshold switches to the backoff interval.
+  eth_tx_manager()->OnBlockTrackerPolled();
+  eth_tx_manager()->CheckIfBlockTrackerShouldRun();
+  EXPECT_EQ(base::Seconds(kBlockTrackerBackoffTimeInSeconds),
+            block_tracker->GetInterval());
+  EXPECT_EQ(initial_stats.polls + kBlockTrackerChecksBeforeBackoff,
+            eth_tx_manager()->block_tracker_stats().polls);
+  EXPECT_EQ(initial_stats.backoffs + 1,
+            eth_tx_manager()->block_tracker_stats().backoffs);
+
+  // Further polls stay backed off without counting another backoff.
+  eth_tx_manager()->OnBlockTrackerPolled();
+  eth_tx_manager()->CheckIfBlockTrackerShouldRun();
+  EXPECT_EQ(base::Seconds(kBlockTrackerBackoffTimeInSeconds),
+            block_tracker->GetInterval());
+  EXPECT_EQ(initial_stats.backoffs + 1,
+            eth_tx_manager()->block_tracker_stats().backoffs);
+
+  // Starting over goes back to the default interval, and backs off again at
+  // the same boundary.
+  tx_service_->Reset();
+  eth_tx_manager()->CheckIfBlockTrackerShouldRun();
+  EXPECT_EQ(base::Seconds(kBlockTrackerDefaultTimeInSeconds),
+            block_tracker->GetInterval());
+  for (int i = 0; i < kBlockTrackerChecksBeforeBackoff; ++i) {
+    EXPECT_EQ(base::Seconds(kBlockTrackerDefaultTimeInSeconds),
+              block_tracker->GetInterval());
+    eth_tx_manager()->OnBlockTrackerPolled();
+    eth_tx_manager()->CheckIfBlockTrackerShouldRun();
+  }
+  EXPECT_EQ(base::Seconds(kBlockTrackerBackoffTimeInSeconds),
+            block_tracker->GetInterval());
+  EXPECT_EQ(initial_stats.backoffs + 2,
+            eth_tx_manager()->block_tracker_stats().backoffs);
+}
+
 }  //  namespace brave_wallet
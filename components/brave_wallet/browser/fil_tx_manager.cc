@@ -382,6 +382,7 @@ void FilTxManager::OnGetFilStateSearchMsgLimited(
 }
 
 void FilTxManager::OnLatestHeightUpdated(uint64_t latest_height) {
+  OnBlockTrackerPolled();
   UpdatePendingTransactions();
 }
 
@@ -9,7 +9,9 @@
 #include <utility>
 
 #include "base/environment.h"
+#include "base/json/json_reader.h"
 #include "base/json/json_writer.h"
+#include "base/notreached.h"
 #include "brave/components/brave_wallet/common/eth_request_helper.h"
 #include "brave/components/brave_wallet/common/web3_provider_constants.h"
 #include "brave/components/constants/brave_services_key.h"
@@ -37,6 +39,21 @@ std::string GetJSON(base::ValueView dict) {
   return json;
 }
 
+std::string GetJsonRpcBatchString(
+    const std::vector<std::string>& json_payloads) {
+  base::Value::List batch;
+  for (size_t i = 0; i < json_payloads.size(); ++i) {
+    auto request = base::JSONReader::Read(json_payloads[i]);
+    if (!request || !request->is_dict()) {
+      NOTREACHED() << "Invalid JSON RPC request: " << json_payloads[i];
+      return std::string();
+    }
+    request->GetDict().Set("id", static_cast<int>(i));
+    batch.Append(std::move(*request));
+  }
+  return GetJSON(batch);
+}
+
 void AddKeyIfNotEmpty(base::Value::Dict* dict,
                       base::StringPiece name,
                       base::StringPiece val) {
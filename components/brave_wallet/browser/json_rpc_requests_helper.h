@@ -8,6 +8,7 @@
 
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "base/containers/flat_map.h"
 #include "base/values.h"
@@ -37,6 +38,11 @@ std::string GetJsonRpcString(base::StringPiece method, Args&&... args) {
   return GetJSON(GetJsonRpcDictionary(method, std::move(params)));
 }
 
+// Combines JSON RPC requests into a single batch request. Each request gets
+// its index in |json_payloads| as id so that the responses, which may come in
+// any order, can be matched to it with ParseJsonRpcBatchResponse.
+std::string GetJsonRpcBatchString(const std::vector<std::string>& json_payloads);
+
 void AddKeyIfNotEmpty(base::Value::Dict* dict,
                       base::StringPiece name,
                       base::StringPiece val);
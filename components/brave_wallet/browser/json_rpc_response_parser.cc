@@ -38,6 +38,24 @@ absl::optional<std::vector<uint8_t>> ParseDecodedBytesResult(
   return PrefixedHexStringToBytes(*result_str);
 }
 
+absl::optional<std::vector<base::Value>> ParseJsonRpcBatchResponse(
+    const base::Value& json_value,
+    size_t num_requests) {
+  if (!json_value.is_list())
+    return absl::nullopt;
+
+  std::vector<base::Value> responses(num_requests);
+  for (const auto& response : json_value.GetList()) {
+    if (!response.is_dict())
+      continue;
+    absl::optional<int> id = response.GetDict().FindInt("id");
+    if (!id || *id < 0 || static_cast<size_t>(*id) >= num_requests)
+      continue;
+    responses[*id] = response.Clone();
+  }
+  return responses;
+}
+
 absl::optional<base::Value> ParseResultValue(const base::Value& json_value) {
   auto response = json_rpc_responses::RPCResponse::FromValue(json_value);
   if (!response || !response->result)
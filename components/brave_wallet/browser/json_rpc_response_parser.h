@@ -28,6 +28,14 @@ absl::optional<base::Value> ParseResultValue(const base::Value& json_value);
 absl::optional<std::vector<uint8_t>> ParseDecodedBytesResult(
     const base::Value& json_value);
 
+// Splits the response to a batch request made with GetJsonRpcBatchString into
+// the responses to each of its |num_requests| requests, in request order.
+// Requests without a response get a none value. Returns absl::nullopt if
+// |json_value| is not a batch response.
+absl::optional<std::vector<base::Value>> ParseJsonRpcBatchResponse(
+    const base::Value& json_value,
+    size_t num_requests);
+
 template <typename Error>
 void ParseErrorResult(const base::Value& json_value,
                       Error* error,
@@ -42,6 +42,29 @@ TEST(JsonRpcResponseParserUnitTest, ParseDecodedBytesResult) {
   EXPECT_FALSE(ParseDecodedBytesResult(ParseJson(json)));
 }
 
+TEST(JsonRpcResponseParserUnitTest, ParseJsonRpcBatchResponse) {
+  auto json = ParseJson(R"([
+    {"jsonrpc": "2.0", "id": 2, "result": "c"},
+    {"jsonrpc": "2.0", "id": 0, "result": "a"},
+    {"jsonrpc": "2.0", "id": 5, "result": "out of range"},
+    {"jsonrpc": "2.0", "result": "no id"},
+    "not an object"
+  ])");
+  auto responses = ParseJsonRpcBatchResponse(json, 3);
+  ASSERT_TRUE(responses);
+  ASSERT_EQ(responses->size(), 3u);
+  EXPECT_EQ(ParseSingleStringResult((*responses)[0]), "a");
+  EXPECT_TRUE((*responses)[1].is_none());
+  EXPECT_EQ(ParseSingleStringResult((*responses)[2]), "c");
+
+  responses = ParseJsonRpcBatchResponse(ParseJson("[]"), 2);
+  ASSERT_TRUE(responses);
+  EXPECT_EQ(responses->size(), 2u);
+
+  EXPECT_FALSE(ParseJsonRpcBatchResponse(
+      ParseJson(R"({"jsonrpc": "2.0", "id": 0, "result": "a"})"), 1));
+}
+
 TEST(JsonRpcResponseParserUnitTest, ParseBoolResult) {
   std::string json =
       "{\"jsonrpc\":\"2.0\",\"id\":1,\"result\":"
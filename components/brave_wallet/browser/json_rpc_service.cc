@@ -9,13 +9,17 @@
 #include <unordered_set>
 #include <utility>
 
+#include "base/barrier_callback.h"
 #include "base/base64.h"
+#include "base/containers/contains.h"
 #include "base/feature_list.h"
 #include "base/functional/bind.h"
 #include "base/no_destructor.h"
 #include "base/notreached.h"
+#include "base/strings/strcat.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/task/sequenced_task_runner.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_prefs.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
 #include "brave/components/brave_wallet/browser/ens_resolver_task.h"
@@ -38,6 +42,7 @@
 #include "brave/components/brave_wallet/common/eth_address.h"
 #include "brave/components/brave_wallet/common/features.h"
 #include "brave/components/brave_wallet/common/hex_utils.h"
+#include "brave/components/brave_wallet/common/web3_provider_constants.h"
 #include "brave/components/decentralized_dns/core/constants.h"
 #include "brave/components/decentralized_dns/core/utils.h"
 #include "components/grit/brave_components_strings.h"
@@ -192,6 +197,81 @@ decentralized_dns::EnsOffchainResolveMethod FromMojomEnsOffchainResolveMethod(
   return EnsOffchainResolveMethod::kDisabled;
 }
 
+constexpr char kEthCall[] = "eth_call";
+constexpr char kEthGetBalance[] = "eth_getBalance";
+constexpr char kEthGetCode[] = "eth_getCode";
+
+// Read-only methods whose identical concurrent requests share a single network
+// request.
+constexpr const char* kCoalescedMethods[] = {
+    brave_wallet::kEthBlockNumber,
+    kEthCall,
+    kEthGetBalance,
+    kEthGetCode,
+};
+
+// Methods whose responses are cached until the next block.
+constexpr const char* kCachedMethods[] = {
+    kEthCall,
+    kEthGetBalance,
+    kEthGetCode,
+};
+
+api_request_helper::APIRequestResult CloneAPIRequestResult(
+    const api_request_helper::APIRequestResult& api_request_result) {
+  return api_request_helper::APIRequestResult(
+      api_request_result.response_code(), api_request_result.body(),
+      api_request_result.value_body().Clone(), api_request_result.headers(),
+      api_request_result.error_code(), api_request_result.final_url());
+}
+
+brave_wallet::mojom::ProviderError ParseTransactionReceiptResult(
+    const api_request_helper::APIRequestResult& api_request_result,
+    brave_wallet::TransactionReceipt* receipt,
+    std::string* error_message) {
+  if (!api_request_result.Is2XXResponseCode()) {
+    *error_message = l10n_util::GetStringUTF8(IDS_WALLET_INTERNAL_ERROR);
+    return brave_wallet::mojom::ProviderError::kInternalError;
+  }
+  if (!brave_wallet::eth::ParseEthGetTransactionReceipt(
+          api_request_result.value_body(), receipt)) {
+    brave_wallet::mojom::ProviderError error;
+    brave_wallet::ParseErrorResult<brave_wallet::mojom::ProviderError>(
+        api_request_result.value_body(), &error, error_message);
+    return error;
+  }
+  error_message->clear();
+  return brave_wallet::mojom::ProviderError::kSuccess;
+}
+
+// (index in request, receipt)
+using IndexedTxReceipt =
+    std::pair<size_t, absl::optional<brave_wallet::TransactionReceipt>>;
+
+void OnGetIndexedTxReceipt(
+    size_t index,
+    base::OnceCallback<void(IndexedTxReceipt)> callback,
+    brave_wallet::TransactionReceipt receipt,
+    brave_wallet::mojom::ProviderError error,
+    const std::string& error_message) {
+  if (error != brave_wallet::mojom::ProviderError::kSuccess) {
+    std::move(callback).Run({index, absl::nullopt});
+    return;
+  }
+  std::move(callback).Run({index, std::move(receipt)});
+}
+
+void OnGetIndexedTxReceipts(
+    brave_wallet::JsonRpcService::GetTxReceiptsCallback callback,
+    std::vector<IndexedTxReceipt> indexed_receipts) {
+  std::vector<absl::optional<brave_wallet::TransactionReceipt>> receipts(
+      indexed_receipts.size());
+  for (auto& [index, receipt] : indexed_receipts) {
+    receipts[index] = std::move(receipt);
+  }
+  std::move(callback).Run(std::move(receipts));
+}
+
 namespace solana {
 // https://github.com/solana-labs/solana/blob/f7b2951c79cd07685ed62717e78ab1c200924924/rpc/src/rpc.rs#L1717
 constexpr char kAccountNotCreatedError[] = "could not find account";
@@ -366,6 +446,161 @@ void JsonRpcService::RequestInternal(
                                std::move(conversion_callback));
 }
 
+void JsonRpcService::RequestCoalescedInternal(
+    const std::string& method,
+    const std::string& json_payload,
+    bool auto_retry_on_network_change,
+    const GURL& network_url,
+    RequestIntermediateCallback callback) {
+  DCHECK(network_url.is_valid());
+  DCHECK(base::Contains(kCoalescedMethods, method)) << method;
+
+  const std::string request_key =
+      base::StrCat({network_url.spec(), "\n", json_payload});
+  if (base::FeatureList::IsEnabled(features::kBraveWalletJsonRpcCacheFeature) &&
+      base::Contains(kCachedMethods, method)) {
+    auto cached = response_cache_.Get(request_key);
+    if (cached != response_cache_.end() &&
+        base::TimeTicks::Now() - cached->second.time <
+            features::kJsonRpcCacheTtl.Get()) {
+      ++request_cache_stats_.cache_hits;
+      base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
+          FROM_HERE,
+          base::BindOnce(std::move(callback),
+                         CloneAPIRequestResult(cached->second.result)));
+      return;
+    }
+    ++request_cache_stats_.cache_misses;
+  }
+
+  auto& callbacks = coalesced_requests_[request_key];
+  callbacks.push_back(std::move(callback));
+  if (callbacks.size() > 1) {
+    ++request_cache_stats_.coalesced_requests;
+    return;
+  }
+  api_request_helper_->Request(
+      "POST", network_url, json_payload, "application/json",
+      auto_retry_on_network_change,
+      base::BindOnce(&JsonRpcService::OnCoalescedRequestResult,
+                     weak_ptr_factory_.GetWeakPtr(), request_key, network_url,
+                     method),
+      MakeCommonJsonRpcHeaders(json_payload));
+}
+
+void JsonRpcService::OnCoalescedRequestResult(
+    const std::string& request_key,
+    const GURL& network_url,
+    const std::string& method,
+    APIRequestResult api_request_result) {
+  if (method == kEthBlockNumber) {
+    OnBlockNumberResult(network_url, api_request_result);
+  } else if (base::FeatureList::IsEnabled(
+                 features::kBraveWalletJsonRpcCacheFeature) &&
+             base::Contains(kCachedMethods, method) &&
+             api_request_result.Is2XXResponseCode() &&
+             ParseResultValue(api_request_result.value_body())) {
+    response_cache_.Put(
+        request_key,
+        CachedResponse{network_url.spec(), base::TimeTicks::Now(),
+                       CloneAPIRequestResult(api_request_result)});
+  }
+
+  auto node = coalesced_requests_.extract(request_key);
+  if (!node) {
+    return;
+  }
+  auto& callbacks = node.mapped();
+  for (size_t i = 0; i + 1 < callbacks.size(); ++i) {
+    std::move(callbacks[i]).Run(CloneAPIRequestResult(api_request_result));
+  }
+  std::move(callbacks.back()).Run(std::move(api_request_result));
+}
+
+void JsonRpcService::OnBlockNumberResult(
+    const GURL& network_url,
+    const APIRequestResult& api_request_result) {
+  uint256_t block_number;
+  if (!api_request_result.Is2XXResponseCode() ||
+      !eth::ParseEthGetBlockNumber(api_request_result.value_body(),
+                                   &block_number)) {
+    return;
+  }
+
+  const std::string network = network_url.spec();
+  auto latest_block_number = latest_block_numbers_.find(network);
+  if (latest_block_number != latest_block_numbers_.end() &&
+      latest_block_number->second == block_number) {
+    return;
+  }
+  latest_block_numbers_[network] = block_number;
+
+  for (auto cached = response_cache_.begin();
+       cached != response_cache_.end();) {
+    if (cached->second.network_url == network) {
+      cached = response_cache_.Erase(cached);
+    } else {
+      ++cached;
+    }
+  }
+}
+
+void JsonRpcService::RequestBatchInternal(
+    const std::vector<std::string>& json_payloads,
+    bool auto_retry_on_network_change,
+    const GURL& network_url,
+    RequestBatchIntermediateCallback callback) {
+  DCHECK(network_url.is_valid());
+
+  const std::string json_payload = GetJsonRpcBatchString(json_payloads);
+  api_request_helper_->Request(
+      "POST", network_url, json_payload, "application/json",
+      auto_retry_on_network_change,
+      base::BindOnce(&JsonRpcService::OnRequestBatchResult,
+                     weak_ptr_factory_.GetWeakPtr(), network_url,
+                     json_payloads.size(), std::move(callback)),
+      MakeCommonJsonRpcHeaders(json_payload));
+}
+
+void JsonRpcService::OnRequestBatchResult(
+    const GURL& network_url,
+    size_t num_requests,
+    RequestBatchIntermediateCallback callback,
+    APIRequestResult api_request_result) {
+  absl::optional<std::vector<base::Value>> responses;
+  if (api_request_result.Is2XXResponseCode()) {
+    responses = ParseJsonRpcBatchResponse(api_request_result.value_body(),
+                                          num_requests);
+  }
+  if (!responses) {
+    // Don't try batching again on every poll, callers fall back to one
+    // request per payload.
+    batch_request_backoff_until_[network_url] =
+        base::TimeTicks::Now() +
+        base::Minutes(kJsonRpcBatchBackoffTimeInMinutes);
+    std::move(callback).Run(absl::nullopt);
+    return;
+  }
+  batch_request_backoff_until_.erase(network_url);
+
+  std::vector<APIRequestResult> api_request_results;
+  api_request_results.reserve(responses->size());
+  for (auto& response : *responses) {
+    std::string body = response.is_none() ? "" : GetJSON(response);
+    api_request_results.emplace_back(
+        api_request_result.response_code(), std::move(body),
+        std::move(response), api_request_result.headers(),
+        api_request_result.error_code(), api_request_result.final_url());
+  }
+  std::move(callback).Run(std::move(api_request_results));
+}
+
+bool JsonRpcService::IsBatchRequestBackedOff(const GURL& network_url) const {
+  auto it = batch_request_backoff_until_.find(network_url);
+  return it != batch_request_backoff_until_.end() &&
+         base::TimeTicks::Now() < it->second;
+}
+
 void JsonRpcService::Request(const std::string& json_payload,
                              bool auto_retry_on_network_change,
                              base::Value id,
@@ -735,9 +970,9 @@ void JsonRpcService::GetBlockNumber(GetBlockNumberCallback callback) {
   auto internal_callback =
       base::BindOnce(&JsonRpcService::OnGetBlockNumber,
                      weak_ptr_factory_.GetWeakPtr(), std::move(callback));
-  RequestInternal(eth::eth_blockNumber(), true,
-                  network_urls_[mojom::CoinType::ETH],
-                  std::move(internal_callback));
+  RequestCoalescedInternal(kEthBlockNumber, eth::eth_blockNumber(), true,
+                           network_urls_[mojom::CoinType::ETH],
+                           std::move(internal_callback));
 }
 
 void JsonRpcService::GetCode(const std::string& address,
@@ -755,8 +990,8 @@ void JsonRpcService::GetCode(const std::string& address,
   auto internal_callback =
       base::BindOnce(&JsonRpcService::OnGetCode, weak_ptr_factory_.GetWeakPtr(),
                      std::move(callback));
-  RequestInternal(eth::eth_getCode(address, "latest"), true, network_url,
-                  std::move(internal_callback));
+  RequestCoalescedInternal(kEthGetCode, eth::eth_getCode(address, "latest"),
+                           true, network_url, std::move(internal_callback));
 }
 
 void JsonRpcService::OnGetFilStateSearchMsgLimited(
@@ -864,8 +1099,9 @@ void JsonRpcService::GetBalance(const std::string& address,
     auto internal_callback =
         base::BindOnce(&JsonRpcService::OnEthGetBalance,
                        weak_ptr_factory_.GetWeakPtr(), std::move(callback));
-    RequestInternal(eth::eth_getBalance(address, kEthereumBlockTagLatest), true,
-                    network_url, std::move(internal_callback));
+    RequestCoalescedInternal(
+        kEthGetBalance, eth::eth_getBalance(address, kEthereumBlockTagLatest),
+        true, network_url, std::move(internal_callback));
     return;
   } else if (coin == mojom::CoinType::FIL) {
     auto internal_callback =
@@ -1075,23 +1311,69 @@ void JsonRpcService::OnGetTransactionReceipt(
     GetTxReceiptCallback callback,
     APIRequestResult api_request_result) {
   TransactionReceipt receipt;
-  if (!api_request_result.Is2XXResponseCode()) {
-    std::move(callback).Run(
-        receipt, mojom::ProviderError::kInternalError,
-        l10n_util::GetStringUTF8(IDS_WALLET_INTERNAL_ERROR));
+  std::string error_message;
+  mojom::ProviderError error = ParseTransactionReceiptResult(
+      api_request_result, &receipt, &error_message);
+  std::move(callback).Run(receipt, error, error_message);
+}
+
+void JsonRpcService::GetTransactionReceipts(
+    const std::vector<std::string>& tx_hashes,
+    GetTxReceiptsCallback callback) {
+  const GURL& network_url = network_urls_[mojom::CoinType::ETH];
+  if (tx_hashes.size() <= 1 || IsBatchRequestBackedOff(network_url)) {
+    GetTransactionReceiptsIndividually(tx_hashes, std::move(callback));
     return;
   }
-  if (!eth::ParseEthGetTransactionReceipt(api_request_result.value_body(),
-                                          &receipt)) {
-    mojom::ProviderError error;
-    std::string error_message;
-    ParseErrorResult<mojom::ProviderError>(api_request_result.value_body(),
-                                           &error, &error_message);
-    std::move(callback).Run(receipt, error, error_message);
+
+  std::vector<std::string> json_payloads;
+  json_payloads.reserve(tx_hashes.size());
+  for (const auto& tx_hash : tx_hashes) {
+    json_payloads.push_back(eth::eth_getTransactionReceipt(tx_hash));
+  }
+  RequestBatchInternal(
+      json_payloads, true, network_url,
+      base::BindOnce(&JsonRpcService::OnGetTransactionReceipts,
+                     weak_ptr_factory_.GetWeakPtr(), tx_hashes,
+                     std::move(callback)));
+}
+
+void JsonRpcService::OnGetTransactionReceipts(
+    std::vector<std::string> tx_hashes,
+    GetTxReceiptsCallback callback,
+    absl::optional<std::vector<APIRequestResult>> api_request_results) {
+  if (!api_request_results) {
+    GetTransactionReceiptsIndividually(tx_hashes, std::move(callback));
     return;
   }
 
-  std::move(callback).Run(receipt, mojom::ProviderError::kSuccess, "");
+  std::vector<absl::optional<TransactionReceipt>> receipts;
+  receipts.reserve(api_request_results->size());
+  for (const auto& api_request_result : *api_request_results) {
+    TransactionReceipt receipt;
+    std::string error_message;
+    if (ParseTransactionReceiptResult(api_request_result, &receipt,
+                                      &error_message) ==
+        mojom::ProviderError::kSuccess) {
+      receipts.push_back(std::move(receipt));
+    } else {
+      receipts.push_back(absl::nullopt);
+    }
+  }
+  std::move(callback).Run(std::move(receipts));
+}
+
+void JsonRpcService::GetTransactionReceiptsIndividually(
+    const std::vector<std::string>& tx_hashes,
+    GetTxReceiptsCallback callback) {
+  const auto barrier_callback = base::BarrierCallback<IndexedTxReceipt>(
+      tx_hashes.size(),
+      base::BindOnce(&OnGetIndexedTxReceipts, std::move(callback)));
+  for (size_t i = 0; i < tx_hashes.size(); ++i) {
+    GetTransactionReceipt(
+        tx_hashes[i],
+        base::BindOnce(&OnGetIndexedTxReceipt, i, barrier_callback));
+  }
 }
 
 void JsonRpcService::SendRawTransaction(const std::string& signed_tx,
@@ -1143,7 +1425,8 @@ void JsonRpcService::GetERC20TokenBalance(
   auto internal_callback =
       base::BindOnce(&JsonRpcService::OnGetERC20TokenBalance,
                      weak_ptr_factory_.GetWeakPtr(), std::move(callback));
-  RequestInternal(
+  RequestCoalescedInternal(
+      kEthCall,
       eth::eth_call("", contract, "", "", "", data, kEthereumBlockTagLatest),
       true, network_url, std::move(internal_callback));
 }
@@ -1215,10 +1498,11 @@ void JsonRpcService::GetERC20TokenAllowance(
   auto internal_callback =
       base::BindOnce(&JsonRpcService::OnGetERC20TokenAllowance,
                      weak_ptr_factory_.GetWeakPtr(), std::move(callback));
-  RequestInternal(eth::eth_call("", contract_address, "", "", "", data,
-                                kEthereumBlockTagLatest),
-                  true, network_urls_[mojom::CoinType::ETH],
-                  std::move(internal_callback));
+  RequestCoalescedInternal(kEthCall,
+                           eth::eth_call("", contract_address, "", "", "",
+                                         data, kEthereumBlockTagLatest),
+                           true, network_urls_[mojom::CoinType::ETH],
+                           std::move(internal_callback));
 }
 
 void JsonRpcService::OnGetERC20TokenAllowance(
@@ -1295,7 +1579,8 @@ void JsonRpcService::GetERC20TokenBalances(
   auto internal_callback = base::BindOnce(
       &JsonRpcService::OnGetERC20TokenBalances, weak_ptr_factory_.GetWeakPtr(),
       token_contract_addresses, std::move(callback));
-  RequestInternal(
+  RequestCoalescedInternal(
+      kEthCall,
       eth::eth_call(balance_scanner_contract_address, calldata.value()), true,
       network_url, std::move(internal_callback));
 }
@@ -1366,9 +1651,10 @@ void JsonRpcService::EnsRegistryGetResolver(const std::string& domain,
   auto internal_callback =
       base::BindOnce(&JsonRpcService::OnEnsRegistryGetResolver,
                      weak_ptr_factory_.GetWeakPtr(), std::move(callback));
-  RequestInternal(eth::eth_call("", contract_address, "", "", "", data,
-                                kEthereumBlockTagLatest),
-                  true, GetEnsRpcUrl(), std::move(internal_callback));
+  RequestCoalescedInternal(kEthCall,
+                           eth::eth_call("", contract_address, "", "", "",
+                                         data, kEthereumBlockTagLatest),
+                           true, GetEnsRpcUrl(), std::move(internal_callback));
 }
 
 void JsonRpcService::OnEnsRegistryGetResolver(
@@ -1454,9 +1740,10 @@ void JsonRpcService::ContinueEnsGetContentHash(
   auto internal_callback =
       base::BindOnce(&JsonRpcService::OnEnsGetContentHash,
                      weak_ptr_factory_.GetWeakPtr(), std::move(callback));
-  RequestInternal(eth::eth_call("", resolver_address, "", "", "", data,
-                                kEthereumBlockTagLatest),
-                  true, GetEnsRpcUrl(), std::move(internal_callback));
+  RequestCoalescedInternal(kEthCall,
+                           eth::eth_call("", resolver_address, "", "", "",
+                                         data, kEthereumBlockTagLatest),
+                           true, GetEnsRpcUrl(), std::move(internal_callback));
 }
 
 void JsonRpcService::OnEnsGetContentHash(EnsGetContentHashCallback callback,
@@ -1787,9 +2074,10 @@ void JsonRpcService::ContinueEnsGetEthAddr(const std::string& domain,
   auto internal_callback =
       base::BindOnce(&JsonRpcService::OnEnsGetEthAddr,
                      weak_ptr_factory_.GetWeakPtr(), std::move(callback));
-  RequestInternal(eth::eth_call("", resolver_address, "", "", "", data,
-                                kEthereumBlockTagLatest),
-                  true, GetEnsRpcUrl(), std::move(internal_callback));
+  RequestCoalescedInternal(kEthCall,
+                           eth::eth_call("", resolver_address, "", "", "",
+                                         data, kEthereumBlockTagLatest),
+                           true, GetEnsRpcUrl(), std::move(internal_callback));
 }
 
 void JsonRpcService::OnEnsGetEthAddr(EnsGetEthAddrCallback callback,
@@ -1855,9 +2143,9 @@ void JsonRpcService::UnstoppableDomainsResolveDns(
     auto eth_call = eth::eth_call(
         "", GetUnstoppableDomainsProxyReaderContractAddress(chain_id), "", "",
         "", *data, kEthereumBlockTagLatest);
-    RequestInternal(std::move(eth_call), true,
-                    GetUnstoppableDomainsRpcUrl(chain_id),
-                    std::move(internal_callback));
+    RequestCoalescedInternal(kEthCall, std::move(eth_call), true,
+                             GetUnstoppableDomainsRpcUrl(chain_id),
+                             std::move(internal_callback));
   }
 }
 
@@ -1921,9 +2209,9 @@ void JsonRpcService::UnstoppableDomainsGetWalletAddr(
     auto eth_call =
         eth::eth_call(GetUnstoppableDomainsProxyReaderContractAddress(chain_id),
                       ToHex(call_data));
-    RequestInternal(std::move(eth_call), true,
-                    GetUnstoppableDomainsRpcUrl(chain_id),
-                    std::move(internal_callback));
+    RequestCoalescedInternal(kEthCall, std::move(eth_call), true,
+                             GetUnstoppableDomainsRpcUrl(chain_id),
+                             std::move(internal_callback));
   }
 }
 
@@ -2199,7 +2487,8 @@ void JsonRpcService::GetERC721OwnerOf(const std::string& contract,
   auto internal_callback =
       base::BindOnce(&JsonRpcService::OnGetERC721OwnerOf,
                      weak_ptr_factory_.GetWeakPtr(), std::move(callback));
-  RequestInternal(
+  RequestCoalescedInternal(
+      kEthCall,
       eth::eth_call("", contract, "", "", "", data, kEthereumBlockTagLatest),
       true, network_url, std::move(internal_callback));
 }
@@ -2338,9 +2627,11 @@ void JsonRpcService::GetEthTokenUri(const std::string& chain_id,
       base::BindOnce(&JsonRpcService::OnGetEthTokenUri,
                      weak_ptr_factory_.GetWeakPtr(), std::move(callback));
 
-  RequestInternal(eth::eth_call("", contract_address, "", "", "",
-                                function_signature, kEthereumBlockTagLatest),
-                  true, network_url, std::move(internal_callback));
+  RequestCoalescedInternal(
+      kEthCall,
+      eth::eth_call("", contract_address, "", "", "", function_signature,
+                    kEthereumBlockTagLatest),
+      true, network_url, std::move(internal_callback));
 }
 
 void JsonRpcService::OnGetEthTokenUri(GetEthTokenUriCallback callback,
@@ -2407,9 +2698,10 @@ void JsonRpcService::GetERC1155TokenBalance(
   auto internal_callback =
       base::BindOnce(&JsonRpcService::OnEthGetBalance,
                      weak_ptr_factory_.GetWeakPtr(), std::move(callback));
-  RequestInternal(eth::eth_call("", contract_address, "", "", "", data,
-                                kEthereumBlockTagLatest),
-                  true, network_url, std::move(internal_callback));
+  RequestCoalescedInternal(kEthCall,
+                           eth::eth_call("", contract_address, "", "", "",
+                                         data, kEthereumBlockTagLatest),
+                           true, network_url, std::move(internal_callback));
 }
 
 void JsonRpcService::EthGetLogs(const std::string& chain_id,
@@ -2476,9 +2768,10 @@ void JsonRpcService::GetSupportsInterface(
       base::BindOnce(&JsonRpcService::OnGetSupportsInterface,
                      weak_ptr_factory_.GetWeakPtr(), std::move(callback));
   DCHECK(network_urls_.contains(mojom::CoinType::ETH));
-  RequestInternal(eth::eth_call("", contract_address, "", "", "", data,
-                                kEthereumBlockTagLatest),
-                  true, network_url, std::move(internal_callback));
+  RequestCoalescedInternal(kEthCall,
+                           eth::eth_call("", contract_address, "", "", "",
+                                         data, kEthereumBlockTagLatest),
+                           true, network_url, std::move(internal_callback));
 }
 
 void JsonRpcService::OnGetSupportsInterface(
@@ -2659,6 +2952,8 @@ void JsonRpcService::Reset() {
 
   add_chain_pending_requests_.clear();
   switch_chain_requests_.clear();
+  response_cache_.Clear();
+  latest_block_numbers_.clear();
   // Reject pending suggest token requests when network changed.
   for (auto& callback : switch_chain_callbacks_) {
     base::Value formed_response = GetProviderErrorDictionary(
@@ -7,15 +7,18 @@
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_JSON_RPC_SERVICE_H_
 
 #include <list>
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "base/containers/flat_map.h"
+#include "base/containers/lru_cache.h"
 #include "base/functional/callback.h"
 #include "base/memory/weak_ptr.h"
 #include "base/observer_list_threadsafe.h"
+#include "base/time/time.h"
 #include "brave/components/api_request_helper/api_request_helper.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
 #include "brave/components/brave_wallet/browser/ens_resolver_task.h"
@@ -83,6 +86,19 @@ class JsonRpcService : public KeyedService, public mojom::JsonRpcService {
                               const std::string& error_message)>;
   using RequestIntermediateCallback =
       base::OnceCallback<void(APIRequestResult api_request_result)>;
+  using RequestBatchIntermediateCallback = base::OnceCallback<void(
+      absl::optional<std::vector<APIRequestResult>> api_request_results)>;
+
+  // Counts requests deduplicated by RequestCoalescedInternal, and lookups in
+  // its response cache.
+  struct RequestCacheStats {
+    size_t cache_hits = 0;
+    size_t cache_misses = 0;
+    size_t coalesced_requests = 0;
+  };
+  const RequestCacheStats& request_cache_stats() const {
+    return request_cache_stats_;
+  }
   using GetFeeHistoryCallback = base::OnceCallback<void(
       const std::vector<std::string>& base_fee_per_gas,
       const std::vector<double>& gas_used_ratio,
@@ -156,6 +172,15 @@ class JsonRpcService : public KeyedService, public mojom::JsonRpcService {
   void GetTransactionReceipt(const std::string& tx_hash,
                              GetTxReceiptCallback callback);
 
+  // Receipts of the requested transactions, in request order. A receipt is
+  // absl::nullopt if it couldn't be fetched.
+  using GetTxReceiptsCallback = base::OnceCallback<void(
+      std::vector<absl::optional<TransactionReceipt>> receipts)>;
+  // Fetches the receipts with a single batch request, or with one request per
+  // transaction if the network doesn't support batch requests.
+  void GetTransactionReceipts(const std::vector<std::string>& tx_hashes,
+                              GetTxReceiptsCallback callback);
+
   using SendRawTxCallback =
       base::OnceCallback<void(const std::string& tx_hash,
                               mojom::ProviderError error,
@@ -490,6 +515,13 @@ class JsonRpcService : public KeyedService, public mojom::JsonRpcService {
                                  APIRequestResult api_request_result);
   void OnGetTransactionReceipt(GetTxReceiptCallback callback,
                                APIRequestResult api_request_result);
+  void OnGetTransactionReceipts(
+      std::vector<std::string> tx_hashes,
+      GetTxReceiptsCallback callback,
+      absl::optional<std::vector<APIRequestResult>> api_request_results);
+  void GetTransactionReceiptsIndividually(
+      const std::vector<std::string>& tx_hashes,
+      GetTxReceiptsCallback callback);
   void OnSendRawTransaction(SendRawTxCallback callback,
                             APIRequestResult api_request_result);
   void OnGetERC20TokenBalance(GetERC20TokenBalanceCallback callback,
@@ -564,6 +596,37 @@ class JsonRpcService : public KeyedService, public mojom::JsonRpcService {
       const GURL& network_url,
       RequestIntermediateCallback callback,
       APIRequestHelper::ResponseConversionCallback conversion_callback);
+  // Like RequestInternal, for a read-only |method| that |json_payload| calls.
+  // Identical concurrent requests share one network request and, when
+  // kBraveWalletJsonRpcCacheFeature is enabled, some responses are reused
+  // until the next block.
+  void RequestCoalescedInternal(const std::string& method,
+                                const std::string& json_payload,
+                                bool auto_retry_on_network_change,
+                                const GURL& network_url,
+                                RequestIntermediateCallback callback);
+  // Sends |json_payloads| as a single JSON RPC batch request. |callback| gets
+  // the result of each request in the order of |json_payloads|, or
+  // absl::nullopt if the network didn't answer with a batch response.
+  void RequestBatchInternal(const std::vector<std::string>& json_payloads,
+                            bool auto_retry_on_network_change,
+                            const GURL& network_url,
+                            RequestBatchIntermediateCallback callback);
+  void OnRequestBatchResult(const GURL& network_url,
+                            size_t num_requests,
+                            RequestBatchIntermediateCallback callback,
+                            APIRequestResult api_request_result);
+  // Whether |network_url| recently failed a batch request, in which case
+  // requests to it should be sent one by one.
+  bool IsBatchRequestBackedOff(const GURL& network_url) const;
+  void OnCoalescedRequestResult(const std::string& request_key,
+                                const GURL& network_url,
+                                const std::string& method,
+                                APIRequestResult api_request_result);
+  // Drops the cached responses of |network_url| when |api_request_result|
+  // of eth_blockNumber reports a new block.
+  void OnBlockNumberResult(const GURL& network_url,
+                           const APIRequestResult& api_request_result);
   void OnEthChainIdValidatedForOrigin(const std::string& chain_id,
                                       const GURL& rpc_url,
                                       APIRequestResult api_request_result);
@@ -620,7 +683,24 @@ class JsonRpcService : public KeyedService, public mojom::JsonRpcService {
   scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
   std::unique_ptr<APIRequestHelper> api_request_helper_;
   std::unique_ptr<APIRequestHelper> api_request_helper_ens_offchain_;
+
+  struct CachedResponse {
+    std::string network_url;
+    base::TimeTicks time;
+    APIRequestResult result;
+  };
+  // <network url + request payload, callbacks of identical pending requests>
+  std::map<std::string, std::vector<RequestIntermediateCallback>>
+      coalesced_requests_;
+  // <network url + request payload, response>
+  base::LRUCache<std::string, CachedResponse> response_cache_{100};
+  // <network url, latest block number seen on the network>
+  base::flat_map<std::string, uint256_t> latest_block_numbers_;
+  RequestCacheStats request_cache_stats_;
   base::flat_map<mojom::CoinType, GURL> network_urls_;
+  // Networks that failed a batch request, with the time until which batching
+  // is skipped for them.
+  base::flat_map<GURL, base::TimeTicks> batch_request_backoff_until_;
   // <mojom::CoinType, chain_id>
   base::flat_map<mojom::CoinType, std::string> chain_ids_;
   // <chain_id, mojom::AddChainRequest>
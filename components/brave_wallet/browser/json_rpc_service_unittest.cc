@@ -16,6 +16,7 @@
 #include "base/containers/span.h"
 #include "base/functional/bind.h"
 #include "base/functional/callback.h"
+#include "base/functional/callback_helpers.h"
 #include "base/json/json_reader.h"
 #include "base/json/json_writer.h"
 #include "base/notreached.h"
@@ -2512,6 +2513,166 @@ TEST_F(JsonRpcServiceUnitTest, GetBalance) {
   EXPECT_TRUE(callback_called);
 }
 
+TEST_F(JsonRpcServiceUnitTest, CoalesceIdenticalRequests) {
+  size_t num_requests = 0;
+  url_loader_factory_.SetInterceptor(
+      base::BindLambdaForTesting([&](const network::ResourceRequest& request) {
+        ++num_requests;
+        url_loader_factory_.ClearResponses();
+        url_loader_factory_.AddResponse(request.url.spec(),
+                                        MakeJsonRpcStringResponse("0xb539d5"));
+      }));
+
+  bool callback1_called = false;
+  bool callback2_called = false;
+  bool callback3_called = false;
+  json_rpc_service_->GetBalance(
+      "0x4e02f254184E904300e0775E4b8eeCB1", mojom::CoinType::ETH,
+      mojom::kMainnetChainId,
+      base::BindOnce(&OnStringResponse, &callback1_called,
+                     mojom::ProviderError::kSuccess, "", "0xb539d5"));
+  json_rpc_service_->GetBalance(
+      "0x4e02f254184E904300e0775E4b8eeCB1", mojom::CoinType::ETH,
+      mojom::kMainnetChainId,
+      base::BindOnce(&OnStringResponse, &callback2_called,
+                     mojom::ProviderError::kSuccess, "", "0xb539d5"));
+  // Different params are not coalesced.
+  json_rpc_service_->GetBalance(
+      "0x4e02f254184E904300e0775E4b8eeCB2", mojom::CoinType::ETH,
+      mojom::kMainnetChainId,
+      base::BindOnce(&OnStringResponse, &callback3_called,
+                     mojom::ProviderError::kSuccess, "", "0xb539d5"));
+  base::RunLoop().RunUntilIdle();
+  EXPECT_TRUE(callback1_called);
+  EXPECT_TRUE(callback2_called);
+  EXPECT_TRUE(callback3_called);
+  EXPECT_EQ(num_requests, 2u);
+  EXPECT_EQ(json_rpc_service_->request_cache_stats().coalesced_requests, 1u);
+
+  // Completed requests are not cached without the cache feature.
+  callback1_called = false;
+  json_rpc_service_->GetBalance(
+      "0x4e02f254184E904300e0775E4b8eeCB1", mojom::CoinType::ETH,
+      mojom::kMainnetChainId,
+      base::BindOnce(&OnStringResponse, &callback1_called,
+                     mojom::ProviderError::kSuccess, "", "0xb539d5"));
+  base::RunLoop().RunUntilIdle();
+  EXPECT_TRUE(callback1_called);
+  EXPECT_EQ(num_requests, 3u);
+  EXPECT_EQ(json_rpc_service_->request_cache_stats().cache_hits, 0u);
+}
+
+TEST_F(JsonRpcServiceUnitTest, ProviderRequestsAreNotCoalesced) {
+  size_t num_requests = 0;
+  url_loader_factory_.SetInterceptor(
+      base::BindLambdaForTesting([&](const network::ResourceRequest& request) {
+        ++num_requests;
+        url_loader_factory_.ClearResponses();
+        url_loader_factory_.AddResponse(request.url.spec(),
+                                        MakeJsonRpcStringResponse("0xb539d5"));
+      }));
+
+  // Requests forwarded from a page are sent as they are, without looking
+  // into their payload.
+  const std::string request =
+      R"({"jsonrpc":"2.0","id":1,"method":"eth_blockNumber","params":[]})";
+  bool callback1_called = false;
+  bool callback2_called = false;
+  json_rpc_service_->Request(
+      request, true, base::Value(), mojom::CoinType::ETH,
+      base::BindOnce(&OnRequestResponse, &callback1_called, true /* success */,
+                     "\"0xb539d5\""));
+  json_rpc_service_->Request(
+      request, true, base::Value(), mojom::CoinType::ETH,
+      base::BindOnce(&OnRequestResponse, &callback2_called, true /* success */,
+                     "\"0xb539d5\""));
+  base::RunLoop().RunUntilIdle();
+  EXPECT_TRUE(callback1_called);
+  EXPECT_TRUE(callback2_called);
+  EXPECT_EQ(num_requests, 2u);
+  EXPECT_EQ(json_rpc_service_->request_cache_stats().coalesced_requests, 0u);
+  EXPECT_EQ(json_rpc_service_->request_cache_stats().cache_misses, 0u);
+}
+
+TEST_F(JsonRpcServiceUnitTest, ResponseCacheIsScopedToBlock) {
+  base::test::ScopedFeatureList feature_list(
+      features::kBraveWalletJsonRpcCacheFeature);
+  size_t num_requests = 0;
+  std::string block_number = "0x1";
+  url_loader_factory_.SetInterceptor(
+      base::BindLambdaForTesting([&](const network::ResourceRequest& request) {
+        ++num_requests;
+        std::string method;
+        request.headers.GetHeader("X-Eth-Method", &method);
+        const std::string result =
+            method == "eth_blockNumber" ? block_number : "0xb539d5";
+        url_loader_factory_.ClearResponses();
+        url_loader_factory_.AddResponse(request.url.spec(),
+                                        MakeJsonRpcStringResponse(result));
+      }));
+  auto get_balance = [&]() {
+    bool callback_called = false;
+    json_rpc_service_->GetBalance(
+        "0x4e02f254184E904300e0775E4b8eeCB1", mojom::CoinType::ETH,
+        mojom::kLocalhostChainId,
+        base::BindOnce(&OnStringResponse, &callback_called,
+                       mojom::ProviderError::kSuccess, "", "0xb539d5"));
+    base::RunLoop().RunUntilIdle();
+    EXPECT_TRUE(callback_called);
+  };
+  auto get_block_number = [&]() {
+    json_rpc_service_->GetBlockNumber(base::DoNothing());
+    base::RunLoop().RunUntilIdle();
+  };
+
+  get_balance();
+  EXPECT_EQ(num_requests, 1u);
+  get_balance();
+  EXPECT_EQ(num_requests, 1u);
+  EXPECT_EQ(json_rpc_service_->request_cache_stats().cache_hits, 1u);
+  EXPECT_EQ(json_rpc_service_->request_cache_stats().cache_misses, 1u);
+
+  // A new block drops the cached responses.
+  get_block_number();
+  EXPECT_EQ(num_requests, 2u);
+  get_balance();
+  EXPECT_EQ(num_requests, 3u);
+  EXPECT_EQ(json_rpc_service_->request_cache_stats().cache_misses, 2u);
+
+  // The same block doesn't.
+  get_block_number();
+  EXPECT_EQ(num_requests, 4u);
+  get_balance();
+  EXPECT_EQ(num_requests, 4u);
+  EXPECT_EQ(json_rpc_service_->request_cache_stats().cache_hits, 2u);
+
+  block_number = "0x2";
+  get_block_number();
+  get_balance();
+  EXPECT_EQ(num_requests, 6u);
+  EXPECT_EQ(json_rpc_service_->request_cache_stats().cache_misses, 3u);
+
+  // Error responses are not cached.
+  url_loader_factory_.SetInterceptor(
+      base::BindLambdaForTesting([&](const network::ResourceRequest& request) {
+        ++num_requests;
+        url_loader_factory_.ClearResponses();
+        url_loader_factory_.AddResponse(
+            request.url.spec(), MakeJsonRpcErrorResponse(-32005, "Limit"));
+      }));
+  for (int i = 0; i < 2; ++i) {
+    bool callback_called = false;
+    json_rpc_service_->GetBalance(
+        "0x4e02f254184E904300e0775E4b8eeCB3", mojom::CoinType::ETH,
+        mojom::kLocalhostChainId,
+        base::BindOnce(&OnStringResponse, &callback_called,
+                       mojom::ProviderError::kLimitExceeded, "Limit", ""));
+    base::RunLoop().RunUntilIdle();
+    EXPECT_TRUE(callback_called);
+  }
+  EXPECT_EQ(num_requests, 8u);
+}
+
 TEST_F(JsonRpcServiceUnitTest, GetFeeHistory) {
   std::string json =
       R"(
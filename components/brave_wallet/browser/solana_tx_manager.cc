@@ -10,6 +10,7 @@
 
 #include "base/base64.h"
 #include "base/notreached.h"
+#include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
 #include "brave/components/brave_wallet/browser/solana_block_tracker.h"
@@ -206,6 +207,13 @@ void SolanaTxManager::UpdatePendingTransactions() {
       &SolanaTxManager::OnGetBlockHeight, weak_ptr_factory_.GetWeakPtr()));
 }
 
+base::TimeDelta SolanaTxManager::GetBlockTrackerInterval() const {
+  // The block tracker also refreshes the cached blockhash used to sign new
+  // transactions, which expires after the default interval, so it must not
+  // back off.
+  return base::Seconds(kBlockTrackerDefaultTimeInSeconds);
+}
+
 void SolanaTxManager::OnGetBlockHeight(uint64_t block_height,
                                        mojom::SolanaProviderError error,
                                        const std::string& error_message) {
@@ -550,6 +558,7 @@ void SolanaTxManager::OnGetFeeForMessage(GetEstimatedTxFeeCallback callback,
 void SolanaTxManager::OnLatestBlockhashUpdated(
     const std::string& blockhash,
     uint64_t last_valid_block_height) {
+  OnBlockTrackerPolled();
   UpdatePendingTransactions();
 }
 
@@ -99,9 +99,11 @@ class SolanaTxManager : public TxManager, public SolanaBlockTracker::Observer {
                            GetTransactionMessageToSign);
   FRIEND_TEST_ALL_PREFIXES(SolanaTxManagerUnitTest,
                            ProcessSolanaHardwareSignature);
+  FRIEND_TEST_ALL_PREFIXES(SolanaTxManagerUnitTest, BlockTrackerInterval);
 
   // TxManager
   void UpdatePendingTransactions() override;
+  base::TimeDelta GetBlockTrackerInterval() const override;
 
   void OnGetBlockHeight(uint64_t block_height,
                         mojom::SolanaProviderError error,
@@ -13,6 +13,7 @@
 #include "base/test/bind.h"
 #include "base/test/scoped_feature_list.h"
 #include "base/test/task_environment.h"
+#include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_prefs.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
@@ -1111,4 +1112,21 @@ TEST_F(SolanaTxManagerUnitTest, ProcessSolanaHardwareSignature) {
                                      "");
 }
 
+TEST_F(SolanaTxManagerUnitTest, BlockTrackerInterval) {
+  auto* block_tracker = solana_tx_manager()->block_tracker_.get();
+  solana_tx_manager()->known_no_pending_tx_ = false;
+  solana_tx_manager()->CheckIfBlockTrackerShouldRun();
+  ASSERT_TRUE(block_tracker->IsRunning());
+
+  // The cached blockhash must be refreshed on time, so pending transactions
+  // don't make the block tracker back off.
+  for (int i = 0; i <= kBlockTrackerChecksBeforeBackoff; ++i) {
+    solana_tx_manager()->OnBlockTrackerPolled();
+    solana_tx_manager()->CheckIfBlockTrackerShouldRun();
+  }
+  EXPECT_TRUE(block_tracker->IsRunning());
+  EXPECT_EQ(base::Seconds(kBlockTrackerDefaultTimeInSeconds),
+            block_tracker->GetInterval());
+}
+
 }  // namespace brave_wallet
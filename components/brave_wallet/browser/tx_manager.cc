@@ -96,14 +96,38 @@ void TxManager::CheckIfBlockTrackerShouldRun() {
       keyring_service_->IsKeyringCreated(mojom::kDefaultKeyringId);
   bool locked = keyring_service_->IsLockedSync();
   bool running = block_tracker_->IsRunning();
-  if (keyring_created && !locked && !running) {
-    block_tracker_->Start(base::Seconds(kBlockTrackerDefaultTimeInSeconds));
-  } else if ((locked || known_no_pending_tx_) && running) {
-    block_tracker_->Stop();
+  if (!keyring_created || locked || known_no_pending_tx_) {
+    if (running) {
+      block_tracker_->Stop();
+    }
+    return;
+  }
+
+  const base::TimeDelta interval = GetBlockTrackerInterval();
+  if (!running || block_tracker_->GetInterval() != interval) {
+    if (interval == base::Seconds(kBlockTrackerBackoffTimeInSeconds)) {
+      ++block_tracker_stats_.backoffs;
+    }
+    block_tracker_->Start(interval);
+  }
+}
+
+void TxManager::OnBlockTrackerPolled() {
+  checks_without_status_change_++;
+  ++block_tracker_stats_.polls;
+}
+
+base::TimeDelta TxManager::GetBlockTrackerInterval() const {
+  // Transactions that haven't settled after a number of checks are most likely
+  // stuck, so there is no point in checking them as often.
+  if (checks_without_status_change_ >= kBlockTrackerChecksBeforeBackoff) {
+    return base::Seconds(kBlockTrackerBackoffTimeInSeconds);
   }
+  return base::Seconds(kBlockTrackerDefaultTimeInSeconds);
 }
 
 void TxManager::OnTransactionStatusChanged(mojom::TransactionInfoPtr tx_info) {
+  checks_without_status_change_ = 0;
   tx_service_->OnTransactionStatusChanged(tx_info->Clone());
 }
 
@@ -116,6 +140,7 @@ void TxManager::Locked() {
 }
 
 void TxManager::Unlocked() {
+  checks_without_status_change_ = 0;
   CheckIfBlockTrackerShouldRun();
   UpdatePendingTransactions();
 }
@@ -135,6 +160,7 @@ void TxManager::KeyringReset() {
 void TxManager::Reset() {
   block_tracker_->Stop();
   known_no_pending_tx_ = false;
+  checks_without_status_change_ = 0;
 }
 
 }  // namespace brave_wallet
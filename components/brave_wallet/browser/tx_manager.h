@@ -77,8 +77,21 @@ class TxManager : public TxStateManager::Observer,
 
   virtual void Reset();
 
+  // Counts block tracker polls, and how often the block tracker was slowed
+  // down because transactions stayed pending.
+  struct BlockTrackerStats {
+    size_t polls = 0;
+    size_t backoffs = 0;
+  };
+  const BlockTrackerStats& block_tracker_stats() const {
+    return block_tracker_stats_;
+  }
+
  protected:
   void CheckIfBlockTrackerShouldRun();
+  // Called by subclasses each time the block tracker polls the network.
+  void OnBlockTrackerPolled();
+  virtual base::TimeDelta GetBlockTrackerInterval() const;
   virtual void UpdatePendingTransactions() = 0;
 
   std::unique_ptr<TxStateManager> tx_state_manager_;
@@ -88,6 +101,9 @@ class TxManager : public TxStateManager::Observer,
   raw_ptr<KeyringService> keyring_service_ = nullptr;   // NOT OWNED
   raw_ptr<PrefService> prefs_ = nullptr;                // NOT OWNED
   bool known_no_pending_tx_ = false;
+  // Number of block tracker polls since a transaction last changed status.
+  int checks_without_status_change_ = 0;
+  BlockTrackerStats block_tracker_stats_;
 
  private:
   // TxStateManager::Observer
@@ -116,22 +116,37 @@ TxStateManager::TxStateManager(PrefService* prefs,
 TxStateManager::~TxStateManager() = default;
 
 void TxStateManager::AddOrUpdateTx(const TxMeta& meta) {
-  ScopedDictPrefUpdate update(prefs_, kBraveWalletTransactions);
-  base::Value::Dict& dict = update.Get();
-  const std::string path =
-      base::JoinString({GetTxPrefPathPrefix(), meta.id()}, ".");
+  AddOrUpdateTxs({&meta});
+}
+
+void TxStateManager::AddOrUpdateTxs(const std::vector<const TxMeta*>& metas) {
+  std::vector<const TxMeta*> added_metas;
+  std::vector<const TxMeta*> updated_metas;
+  {
+    ScopedDictPrefUpdate update(prefs_, kBraveWalletTransactions);
+    base::Value::Dict& dict = update.Get();
+    for (const auto* meta : metas) {
+      const std::string path =
+          base::JoinString({GetTxPrefPathPrefix(), meta->id()}, ".");
+      bool is_add = dict.FindByDottedPath(path) == nullptr;
+      dict.SetByDottedPath(path, meta->ToValue());
+      (is_add ? added_metas : updated_metas).push_back(meta);
+    }
+  }
 
-  bool is_add = dict.FindByDottedPath(path) == nullptr;
-  dict.SetByDottedPath(path, meta.ToValue());
-  if (!is_add) {
+  for (const auto* meta : updated_metas) {
     for (auto& observer : observers_) {
-      observer.OnTransactionStatusChanged(meta.ToTransactionInfo());
+      observer.OnTransactionStatusChanged(meta->ToTransactionInfo());
     }
+  }
+  if (added_metas.empty()) {
     return;
   }
 
-  for (auto& observer : observers_) {
-    observer.OnNewUnapprovedTx(meta.ToTransactionInfo());
+  for (const auto* meta : added_metas) {
+    for (auto& observer : observers_) {
+      observer.OnNewUnapprovedTx(meta->ToTransactionInfo());
+    }
   }
 
   // We only keep most recent 10 confirmed and rejected tx metas per network
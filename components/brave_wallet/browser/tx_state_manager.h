@@ -36,6 +36,9 @@ class TxStateManager {
   TxStateManager(const TxStateManager&) = delete;
 
   void AddOrUpdateTx(const TxMeta& meta);
+  // Same as AddOrUpdateTx for several transactions, with a single update of
+  // the transactions pref.
+  void AddOrUpdateTxs(const std::vector<const TxMeta*>& metas);
   std::unique_ptr<TxMeta> GetTx(const std::string& id);
   void DeleteTx(const std::string& id);
   void WipeTxs();
@@ -368,6 +368,34 @@ TEST_F(TxStateManagerUnitTest, RetireOldTxMeta) {
   EXPECT_TRUE(tx_state_manager_->GetTx("3"));
 }
 
+TEST_F(TxStateManagerUnitTest, AddOrUpdateTxs) {
+  TestTxStateManagerObserver observer;
+  tx_state_manager_->AddObserver(&observer);
+
+  EthTxMeta meta1;
+  meta1.set_id("001");
+  tx_state_manager_->AddOrUpdateTx(meta1);
+  observer.Reset();
+
+  meta1.set_status(mojom::TransactionStatus::Confirmed);
+  EthTxMeta meta2;
+  meta2.set_id("002");
+  meta2.set_status(mojom::TransactionStatus::Submitted);
+  tx_state_manager_->AddOrUpdateTxs({&meta1, &meta2});
+  EXPECT_TRUE(observer.NewUnapprovedTxFired());
+  EXPECT_TRUE(observer.TxStatusChangedFired());
+  observer.ExpectMatch("002", mojom::TransactionStatus::Submitted);
+
+  auto tx1 = tx_state_manager_->GetTx("001");
+  ASSERT_TRUE(tx1);
+  EXPECT_EQ(tx1->status(), mojom::TransactionStatus::Confirmed);
+  auto tx2 = tx_state_manager_->GetTx("002");
+  ASSERT_TRUE(tx2);
+  EXPECT_EQ(tx2->status(), mojom::TransactionStatus::Submitted);
+
+  tx_state_manager_->RemoveObserver(&observer);
+}
+
 TEST_F(TxStateManagerUnitTest, Observer) {
   TestTxStateManagerObserver observer;
   tx_state_manager_->AddObserver(&observer);
@@ -65,5 +65,11 @@ BASE_FEATURE(kBraveWalletBitcoinFeature,
              "BraveWalletBitcoin",
              base::FEATURE_DISABLED_BY_DEFAULT);
 
+BASE_FEATURE(kBraveWalletJsonRpcCacheFeature,
+             "BraveWalletJsonRpcCache",
+             base::FEATURE_DISABLED_BY_DEFAULT);
+const base::FeatureParam<base::TimeDelta> kJsonRpcCacheTtl{
+    &kBraveWalletJsonRpcCacheFeature, "ttl", base::Seconds(5)};
+
 }  // namespace features
 }  // namespace brave_wallet
@@ -24,6 +24,8 @@ BASE_DECLARE_FEATURE(kBraveWalletDappsSupportFeature);
 BASE_DECLARE_FEATURE(kBraveWalletENSL2Feature);
 BASE_DECLARE_FEATURE(kBraveWalletSnsFeature);
 BASE_DECLARE_FEATURE(kBraveWalletBitcoinFeature);
+BASE_DECLARE_FEATURE(kBraveWalletJsonRpcCacheFeature);
+extern const base::FeatureParam<base::TimeDelta> kJsonRpcCacheTtl;
 
 }  // namespace features
 }  // namespace brave_wallet
@@ -5,16 +5,24 @@
 
 #include "brave/components/content_settings/core/browser/brave_content_settings_pref_provider.h"
 
+#include <functional>
+#include <map>
 #include <memory>
+#include <string>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 #include "base/containers/contains.h"
+#include "base/containers/flat_set.h"
 #include "base/functional/bind.h"
 #include "base/json/values_util.h"
 #include "base/logging.h"
+#include "base/memory/raw_ref.h"
 #include "base/no_destructor.h"
 #include "base/ranges/algorithm.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/strings/string_piece.h"
 #include "base/task/bind_post_task.h"
 #include "base/task/sequenced_task_runner.h"
 #include "brave/components/brave_shields/common/brave_shield_constants.h"
@@ -59,24 +67,98 @@ Rule CloneRule(const Rule& original_rule) {
               original_rule.value.Clone(), original_rule.metadata);
 }
 
-bool IsActive(const Rule& cookie_rule, const std::vector<Rule>& shield_rules) {
-  // don't include default rules in the iterator
-  if (cookie_rule.primary_pattern == ContentSettingsPattern::Wildcard() &&
-      cookie_rule.secondary_pattern == ContentSettingsPattern::Wildcard()) {
-    return false;
+using RuleKey =
+    std::tuple<ContentSettingsPattern, ContentSettingsPattern, ContentSetting>;
+using PatternPair = std::pair<ContentSettingsPattern, ContentSettingsPattern>;
+
+RuleKey MakeRuleKey(const Rule& rule) {
+  return {rule.primary_pattern, rule.secondary_pattern,
+          ValueToContentSetting(rule.value)};
+}
+
+base::flat_set<RuleKey> MakeRuleSet(const std::vector<Rule>& rules) {
+  std::vector<RuleKey> keys;
+  keys.reserve(rules.size());
+  for (const auto& rule : rules) {
+    keys.push_back(MakeRuleKey(rule));
   }
+  return base::flat_set<RuleKey>(std::move(keys));
+}
 
-  for (const auto& shield_rule : shield_rules) {
-    auto primary_compare =
-        shield_rule.primary_pattern.Compare(cookie_rule.secondary_pattern);
-    if (primary_compare == ContentSettingsPattern::IDENTITY ||
-        primary_compare == ContentSettingsPattern::SUCCESSOR) {
-      return ValueToContentSetting(shield_rule.value) != CONTENT_SETTING_BLOCK;
+base::flat_set<PatternPair> MakePatternPairSet(const std::vector<Rule>& rules) {
+  std::vector<PatternPair> pattern_pairs;
+  pattern_pairs.reserve(rules.size());
+  for (const auto& rule : rules) {
+    pattern_pairs.emplace_back(rule.primary_pattern, rule.secondary_pattern);
+  }
+  return base::flat_set<PatternPair>(std::move(pattern_pairs));
+}
+
+// Indexes shield rules by the host of their primary pattern so that matching a
+// cookie rule only has to compare against rules that can possibly contain its
+// secondary pattern, instead of every shield rule.
+class ShieldRulesIndex {
+ public:
+  explicit ShieldRulesIndex(const std::vector<Rule>& shield_rules)
+      : shield_rules_(shield_rules) {
+    for (size_t i = 0; i < shield_rules.size(); ++i) {
+      const std::string& host = shield_rules[i].primary_pattern.GetHost();
+      if (host.empty()) {
+        wildcard_host_rules_.push_back(i);
+      } else {
+        rules_by_host_[host].push_back(i);
+      }
     }
   }
 
-  return true;
-}
+  ShieldRulesIndex(const ShieldRulesIndex&) = delete;
+  ShieldRulesIndex& operator=(const ShieldRulesIndex&) = delete;
+
+  bool IsActive(const Rule& cookie_rule) const {
+    // don't include default rules in the iterator
+    if (cookie_rule.primary_pattern == ContentSettingsPattern::Wildcard() &&
+        cookie_rule.secondary_pattern == ContentSettingsPattern::Wildcard()) {
+      return false;
+    }
+
+    // A shield rule can only contain the cookie rule's secondary pattern if it
+    // has a wildcard host, or if its host is the secondary pattern's host or
+    // one of its parent domains.
+    std::vector<size_t> candidates = wildcard_host_rules_;
+    base::StringPiece host = cookie_rule.secondary_pattern.GetHost();
+    while (!host.empty()) {
+      auto it = rules_by_host_.find(host);
+      if (it != rules_by_host_.end()) {
+        candidates.insert(candidates.end(), it->second.begin(),
+                          it->second.end());
+      }
+      const size_t dot = host.find('.');
+      host = dot == base::StringPiece::npos ? base::StringPiece()
+                                            : host.substr(dot + 1);
+    }
+
+    // Shield rules are checked in their original order, so the first match
+    // wins just like it would with a linear scan.
+    base::ranges::sort(candidates);
+    for (size_t index : candidates) {
+      const Rule& shield_rule = (*shield_rules_)[index];
+      auto primary_compare =
+          shield_rule.primary_pattern.Compare(cookie_rule.secondary_pattern);
+      if (primary_compare == ContentSettingsPattern::IDENTITY ||
+          primary_compare == ContentSettingsPattern::SUCCESSOR) {
+        return ValueToContentSetting(shield_rule.value) !=
+               CONTENT_SETTING_BLOCK;
+      }
+    }
+
+    return true;
+  }
+
+ private:
+  const raw_ref<const std::vector<Rule>> shield_rules_;
+  std::map<std::string, std::vector<size_t>, std::less<>> rules_by_host_;
+  std::vector<size_t> wildcard_host_rules_;
+};
 
 }  // namespace
 
@@ -724,9 +806,10 @@ void BravePrefProvider::UpdateCookieRules(ContentSettingsType content_type,
     auto brave_cookies_iterator = PrefProvider::GetRuleIterator(
         ContentSettingsType::BRAVE_COOKIES, incognito);
     // Matching cookie rules against shield rules.
+    const ShieldRulesIndex shield_rules_index(shield_rules);
     while (brave_cookies_iterator && brave_cookies_iterator->HasNext()) {
       auto rule = brave_cookies_iterator->Next();
-      if (IsActive(rule, shield_rules)) {
+      if (shield_rules_index.IsActive(rule)) {
         rules.emplace_back(CloneRule(rule));
         brave_cookie_rules_[incognito].emplace_back(CloneRule(rule));
       }
@@ -764,34 +847,29 @@ void BravePrefProvider::UpdateCookieRules(ContentSettingsType content_type,
 
   // get the list of changes
   std::vector<Rule> brave_cookie_updates;
-  for (const auto& new_rule : brave_cookie_rules_[incognito]) {
-    auto match =
-        base::ranges::find_if(old_rules, [&new_rule](const auto& old_rule) {
-          // we want an exact match here because any change to the rule
-          // is an update
-          return new_rule.primary_pattern == old_rule.primary_pattern &&
-                 new_rule.secondary_pattern == old_rule.secondary_pattern &&
-                 ValueToContentSetting(new_rule.value) ==
-                     ValueToContentSetting(old_rule.value);
-        });
-    if (match == old_rules.end()) {
-      brave_cookie_updates.emplace_back(CloneRule(new_rule));
+  {
+    // we want an exact match here because any change to the rule is an update
+    const auto old_rule_set = MakeRuleSet(old_rules);
+    for (const auto& new_rule : brave_cookie_rules_[incognito]) {
+      if (!old_rule_set.contains(MakeRuleKey(new_rule))) {
+        brave_cookie_updates.emplace_back(CloneRule(new_rule));
+      }
     }
   }
 
   // find any removed rules
-  for (const auto& old_rule : old_rules) {
-    auto match = base::ranges::find_if(
-        brave_cookie_rules_[incognito], [&old_rule](const auto& new_rule) {
-          // we only care about the patterns here because we're looking
-          // for deleted rules, not changed rules
-          return new_rule.primary_pattern == old_rule.primary_pattern &&
-                 new_rule.secondary_pattern == old_rule.secondary_pattern;
-        });
-    if (match == brave_cookie_rules_[incognito].end()) {
-      brave_cookie_updates.emplace_back(old_rule.primary_pattern,
-                                        old_rule.secondary_pattern,
-                                        base::Value(), old_rule.metadata);
+  {
+    // we only care about the patterns here because we're looking for deleted
+    // rules, not changed rules
+    const auto new_pattern_set =
+        MakePatternPairSet(brave_cookie_rules_[incognito]);
+    for (const auto& old_rule : old_rules) {
+      if (!new_pattern_set.contains(
+              {old_rule.primary_pattern, old_rule.secondary_pattern})) {
+        brave_cookie_updates.emplace_back(old_rule.primary_pattern,
+                                          old_rule.secondary_pattern,
+                                          base::Value(), old_rule.metadata);
+      }
     }
   }
   {
@@ -713,4 +713,50 @@ TEST_F(BravePrefProviderTest, EnsureNoWildcardEntries) {
   provider.ShutdownOnUIThread();
 }
 
+TEST_F(BravePrefProviderTest, ShieldsDownOnParentDomainOverridesCookieRules) {
+  BravePrefProvider provider(
+      testing_profile()->GetPrefs(), false /* incognito */,
+      true /* store_last_modified */, false /* restore_session */);
+
+  const GURL third_party_url("https://tracker.com");
+  const GURL subdomain_url("https://sub.brave.com");
+  const GURL other_url("https://example.com");
+
+  for (const auto& url : {subdomain_url, other_url}) {
+    provider.SetWebsiteSetting(ContentSettingsPattern::Wildcard(),
+                               ContentSettingsPattern::FromURL(url),
+                               ContentSettingsType::BRAVE_COOKIES,
+                               ContentSettingToValue(CONTENT_SETTING_BLOCK),
+                               {});
+  }
+  EXPECT_EQ(CONTENT_SETTING_BLOCK,
+            TestUtils::GetContentSetting(&provider, third_party_url,
+                                         subdomain_url,
+                                         ContentSettingsType::COOKIES, false));
+
+  // Shields down on a parent domain turns off the more specific cookie rule.
+  const auto parent_pattern =
+      ContentSettingsPattern::FromString("[*.]brave.com");
+  provider.SetWebsiteSetting(parent_pattern, ContentSettingsPattern::Wildcard(),
+                             ContentSettingsType::BRAVE_SHIELDS,
+                             ContentSettingToValue(CONTENT_SETTING_BLOCK), {});
+  EXPECT_EQ(CONTENT_SETTING_ALLOW,
+            TestUtils::GetContentSetting(&provider, third_party_url,
+                                         subdomain_url,
+                                         ContentSettingsType::COOKIES, false));
+  EXPECT_EQ(CONTENT_SETTING_BLOCK,
+            TestUtils::GetContentSetting(&provider, third_party_url, other_url,
+                                         ContentSettingsType::COOKIES, false));
+
+  provider.SetWebsiteSetting(parent_pattern, ContentSettingsPattern::Wildcard(),
+                             ContentSettingsType::BRAVE_SHIELDS,
+                             ContentSettingToValue(CONTENT_SETTING_ALLOW), {});
+  EXPECT_EQ(CONTENT_SETTING_BLOCK,
+            TestUtils::GetContentSetting(&provider, third_party_url,
+                                         subdomain_url,
+                                         ContentSettingsType::COOKIES, false));
+
+  provider.ShutdownOnUIThread();
+}
+
 }  //  namespace content_settings
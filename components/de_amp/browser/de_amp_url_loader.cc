@@ -71,16 +71,18 @@ void DeAmpURLLoader::OnBodyReadable(MojoResult) {
   if (!CheckBufferedBody(kMaxBytesToCheck - buffered_body_.size())) {
     return;
   }
+  scanner_.Scan(buffered_body_);
   if (MaybeRedirectToCanonicalLink()) {
     // Only abort if we know we're successfully going to the canonical URL
     Abort();
     return;
   }
-  // If we were not redirected and we didn't find AMP, or
-  // if we did find AMP previously and we've already read more bytes than
-  // max, complete the load.
-  if (!found_amp_ || read_bytes_ >= kMaxBytesToCheck) {
-    found_amp_ = false;  // reset
+  // If we were not redirected and we didn't find AMP, or if we did find AMP
+  // and either found the canonical link or already read more bytes than max,
+  // complete the load.
+  if (!de_amp_throttle_ || !scanner_.is_amp_page() ||
+      scanner_.canonical_url().has_value() ||
+      read_bytes_ >= kMaxBytesToCheck) {
     CompleteLoading(std::move(buffered_body_));
     return;
   }
@@ -92,37 +94,30 @@ bool DeAmpURLLoader::MaybeRedirectToCanonicalLink() {
     return false;
   }
 
-  // If we are not already on an AMP page, check if this chunk has the AMP HTML
-  if (!found_amp_ && !CheckIfAmpPage(buffered_body_)) {
+  // The canonical link is only looked for on AMP pages.
+  const auto& canonical_link = scanner_.canonical_url();
+  if (!canonical_link.has_value()) {
     return false;
   }
-
-  found_amp_ = true;  // If we get to this point, we know we have an AMP page
-
-  auto canonical_link = FindCanonicalAmpUrl(buffered_body_);
-  if (!canonical_link.has_value()) {
-    VLOG(2) << __func__ << canonical_link.error();
+  if (!canonical_link->has_value()) {
+    VLOG(2) << __func__ << canonical_link->error();
     return false;
   }
 
-  bool redirected = false;
-  const GURL canonical_url(canonical_link.value());
+  const GURL canonical_url(canonical_link->value());
   // Validate the found canonical AMP URL
-  if (VerifyCanonicalAmpUrl(canonical_url, response_url_)) {
-    // Attempt to go to the canonical URL
-    VLOG(2) << __func__ << " de-amping and loading " << canonical_url;
-    if (de_amp_throttle_->OpenCanonicalURL(canonical_url, response_url_)) {
-      redirected = true;
-    } else {
-      VLOG(2) << __func__ << " failed to open canonical url: " << canonical_url;
-    }
-  } else {
+  if (!VerifyCanonicalAmpUrl(canonical_url, response_url_)) {
     VLOG(2) << __func__ << " canonical link verification failed "
             << canonical_url;
+    return false;
+  }
+  // Attempt to go to the canonical URL
+  VLOG(2) << __func__ << " de-amping and loading " << canonical_url;
+  if (!de_amp_throttle_->OpenCanonicalURL(canonical_url, response_url_)) {
+    VLOG(2) << __func__ << " failed to open canonical url: " << canonical_url;
+    return false;
   }
-  // At this point we've either redirected, or we should stop trying
-  found_amp_ = false;
-  return redirected;
+  return true;
 }
 
 void DeAmpURLLoader::OnBodyWritable(MojoResult r) {
@@ -39,6 +39,56 @@ RE2::Options InitRegexOptions() {
   return opt;
 }
 
+// The order of running these regexes is important: we first get the relevant
+// HTML tag and then find the info.
+const re2::RE2& GetHtmlTagRegex() {
+  static const base::NoDestructor<re2::RE2> kGetHtmlTagRegex(
+      kGetHtmlTagPattern, InitRegexOptions());
+  return *kGetHtmlTagRegex;
+}
+
+const re2::RE2& GetDetectAmpRegex() {
+  static const base::NoDestructor<re2::RE2> kDetectAmpRegex(
+      kDetectAmpPattern, InitRegexOptions());
+  return *kDetectAmpRegex;
+}
+
+const re2::RE2& GetFindCanonicalLinkTagRegex() {
+  static const base::NoDestructor<re2::RE2> kFindCanonicalLinkTagRegex(
+      kFindCanonicalLinkTagPattern, InitRegexOptions());
+  return *kFindCanonicalLinkTagRegex;
+}
+
+const re2::RE2& GetFindCanonicalHrefInTagRegex() {
+  static const base::NoDestructor<re2::RE2> kFindCanonicalHrefInTagRegex(
+      kFindCanonicalHrefInTagPattern, InitRegexOptions());
+  return *kFindCanonicalHrefInTagRegex;
+}
+
+base::expected<std::string, std::string> GetCanonicalHref(
+    const std::string& link_tag) {
+  std::string canonical_url;
+  // Find href in canonical link tag
+  // Check there is only 1 href captured, else fail
+  if (!RE2::PartialMatch(link_tag, GetFindCanonicalHrefInTagRegex(),
+                         &canonical_url)) {
+    // Didn't find canonical link, potentially try again
+    return base::unexpected("Couldn't find canonical URL in link tag");
+  }
+  return base::ok(std::move(canonical_url));
+}
+
+// Both the <html> and the canonical link tag patterns only match a single tag,
+// which ends with the first '>' following its start. So when a pattern isn't
+// found, a later match can only start after the last '>' of the body.
+size_t GetNextSearchOffset(base::StringPiece body, size_t offset) {
+  const size_t last_tag_end = body.rfind('>');
+  if (last_tag_end == base::StringPiece::npos || last_tag_end < offset) {
+    return offset;
+  }
+  return last_tag_end + 1;
+}
+
 }  // namespace
 
 bool IsDeAmpEnabled(PrefService* prefs) {
@@ -55,49 +105,50 @@ bool VerifyCanonicalAmpUrl(const GURL& canonical_link,
 }
 
 bool CheckIfAmpPage(const std::string& body) {
-  auto opt = InitRegexOptions();
-  // The order of running these regexes is important:
-  // we first get the relevant HTML tag and then find the info.
-  static const base::NoDestructor<re2::RE2> kGetHtmlTagRegex(kGetHtmlTagPattern,
-                                                             opt);
-  static const base::NoDestructor<re2::RE2> kDetectAmpRegex(kDetectAmpPattern,
-                                                            opt);
-
-  std::string html_tag;
-  if (!RE2::PartialMatch(body, *kGetHtmlTagRegex, &html_tag)) {
-    // Early exit if we can't find HTML tag - malformed document (or error)
-    return false;
-  }
-  if (!RE2::PartialMatch(html_tag, *kDetectAmpRegex)) {
-    // Not AMP
-    return false;
-  }
-  return true;
+  AmpPageScanner scanner;
+  scanner.Scan(body);
+  return scanner.is_amp_page();
 }
 
 base::expected<std::string, std::string> FindCanonicalAmpUrl(
     const std::string& body) {
-  auto opt = InitRegexOptions();
-  // The order of running these regexes is important
-  static const base::NoDestructor<re2::RE2> kFindCanonicalLinkTagRegex(
-      kFindCanonicalLinkTagPattern, opt);
-  static const base::NoDestructor<re2::RE2> kFindCanonicalHrefInTagRegex(
-      kFindCanonicalHrefInTagPattern, opt);
-
   std::string link_tag;
-  if (!RE2::PartialMatch(body, *kFindCanonicalLinkTagRegex, &link_tag)) {
+  if (!RE2::PartialMatch(body, GetFindCanonicalLinkTagRegex(), &link_tag)) {
     // Can't find link tag, exit
     return base::unexpected("Couldn't find link tag");
   }
-  std::string canonical_url;
-  // Find href in canonical link tag
-  // Check there is only 1 href captured, else fail
-  if (!RE2::PartialMatch(link_tag, *kFindCanonicalHrefInTagRegex,
-                         &canonical_url)) {
-    // Didn't find canonical link, potentially try again
-    return base::unexpected("Couldn't find canonical URL in link tag");
+  return GetCanonicalHref(link_tag);
+}
+
+AmpPageScanner::AmpPageScanner() = default;
+
+AmpPageScanner::~AmpPageScanner() = default;
+
+void AmpPageScanner::Scan(base::StringPiece body) {
+  if (state_ == State::kFindHtmlTag) {
+    std::string html_tag;
+    if (!RE2::PartialMatch(body.substr(html_tag_search_offset_),
+                           GetHtmlTagRegex(), &html_tag)) {
+      html_tag_search_offset_ =
+          GetNextSearchOffset(body, html_tag_search_offset_);
+      return;
+    }
+    state_ = RE2::PartialMatch(html_tag, GetDetectAmpRegex())
+                 ? State::kFindCanonicalLink
+                 : State::kNotAmp;
+  }
+
+  if (state_ == State::kFindCanonicalLink) {
+    std::string link_tag;
+    if (!RE2::PartialMatch(body.substr(canonical_link_search_offset_),
+                           GetFindCanonicalLinkTagRegex(), &link_tag)) {
+      canonical_link_search_offset_ =
+          GetNextSearchOffset(body, canonical_link_search_offset_);
+      return;
+    }
+    canonical_url_ = GetCanonicalHref(link_tag);
+    state_ = State::kDone;
   }
-  return base::ok(std::move(canonical_url));
 }
 
 }  // namespace de_amp
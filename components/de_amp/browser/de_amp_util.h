@@ -8,8 +8,10 @@
 
 #include <string>
 
+#include "base/strings/string_piece.h"
 #include "base/types/expected.h"
 #include "components/prefs/pref_service.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 #include "url/gurl.h"
 
 namespace de_amp {
@@ -26,6 +28,42 @@ base::expected<std::string, std::string> FindCanonicalAmpUrl(
 
 // Validation check for canonical URL
 bool VerifyCanonicalAmpUrl(const GURL& canonical_url, const GURL& original_url);
+
+// Looks for the <html> tag and, on AMP pages, the canonical link in a body
+// which is received in chunks. The same regexes as CheckIfAmpPage() and
+// FindCanonicalAmpUrl() are used, but each call resumes after the last
+// complete tag seen by the previous one, so already scanned bytes are not
+// matched again.
+class AmpPageScanner {
+ public:
+  AmpPageScanner();
+  AmpPageScanner(const AmpPageScanner&) = delete;
+  AmpPageScanner& operator=(const AmpPageScanner&) = delete;
+  ~AmpPageScanner();
+
+  // Scans |body|, which must begin with the body passed to the previous call.
+  void Scan(base::StringPiece body);
+
+  bool found_html_tag() const { return state_ != State::kFindHtmlTag; }
+  bool is_amp_page() const {
+    return state_ == State::kFindCanonicalLink || state_ == State::kDone;
+  }
+
+  // Set once the canonical link tag of an AMP page has been found: either the
+  // canonical URL or an error if the tag has no href.
+  const absl::optional<base::expected<std::string, std::string>>&
+  canonical_url() const {
+    return canonical_url_;
+  }
+
+ private:
+  enum class State { kFindHtmlTag, kNotAmp, kFindCanonicalLink, kDone };
+
+  State state_ = State::kFindHtmlTag;
+  size_t html_tag_search_offset_ = 0;
+  size_t canonical_link_search_offset_ = 0;
+  absl::optional<base::expected<std::string, std::string>> canonical_url_;
+};
 }  // namespace de_amp
 
 #endif  // BRAVE_COMPONENTS_DE_AMP_BROWSER_DE_AMP_UTIL_H_
@@ -3,16 +3,49 @@
  * License, v. 2.0. If a copy of the MPL was not distributed with this file,
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
+#include <string>
+
+#include "base/strings/string_piece.h"
+#include "base/strings/stringprintf.h"
 #include "brave/components/de_amp/browser/de_amp_util.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 namespace de_amp {
 
 /** Test helpers */
+// Feeds |body| to an AmpPageScanner |chunk_size| bytes at a time, like
+// DeAmpURLLoader does as the body is received.
+void CheckScannerResult(const std::string& expected_link,
+                        const std::string& body,
+                        const bool expected_detect_amp,
+                        const bool expected_find_canonical,
+                        size_t chunk_size) {
+  SCOPED_TRACE(testing::Message() << "chunk_size: " << chunk_size);
+  AmpPageScanner scanner;
+  for (size_t size = chunk_size; size < body.size() + chunk_size;
+       size += chunk_size) {
+    scanner.Scan(base::StringPiece(body).substr(0, size));
+  }
+  EXPECT_EQ(expected_detect_amp, scanner.is_amp_page());
+  const auto& canonical_url = scanner.canonical_url();
+  if (expected_detect_amp && expected_find_canonical) {
+    ASSERT_TRUE(canonical_url.has_value());
+    ASSERT_TRUE(canonical_url->has_value());
+    EXPECT_EQ(expected_link, canonical_url->value());
+  } else {
+    EXPECT_FALSE(canonical_url.has_value() && canonical_url->has_value());
+  }
+}
+
 void CheckFindCanonicalLinkResult(const std::string& expected_link,
                                   const std::string& body,
                                   const bool expected_detect_amp,
                                   const bool expected_find_canonical) {
+  for (size_t chunk_size : {1u, 7u, 64u}) {
+    CheckScannerResult(expected_link, body, expected_detect_amp,
+                       expected_find_canonical, chunk_size);
+  }
+
   const bool actual_detect_amp = CheckIfAmpPage(body);
   EXPECT_EQ(expected_detect_amp, actual_detect_amp);
   if (expected_detect_amp) {  // Only check for canonical link if this is an AMP
@@ -247,6 +280,32 @@ TEST(DeAmpUtilUnitTest, DoubleQuotesWithTrueAttributeUpperCase) {
   CheckFindCanonicalLinkResult("https://abc.com", body, true, true);
 }
 
+TEST(DeAmpUtilUnitTest, ScanLargePageInSmallChunks) {
+  std::string body = "<!doctype html><html amp lang=\"en\"><head>";
+  for (int i = 0; i < 5000; ++i) {
+    body += base::StringPrintf(
+        "<meta name=\"meta-%d\" content=\"some content to skip\">", i);
+  }
+  body +=
+      "<link rel=\"canonical\" href=\"https://abc.com\"/>"
+      "</head><body></body></html>";
+  CheckScannerResult("https://abc.com", body, true, true, 512);
+}
+
+TEST(DeAmpUtilUnitTest, ScannerNeedsMoreData) {
+  const std::string body =
+      "<html amp><head><link rel=\"canonical\" href=\"https://abc.com\"/>";
+  AmpPageScanner scanner;
+  scanner.Scan(base::StringPiece(body).substr(0, 8));
+  EXPECT_FALSE(scanner.found_html_tag());
+  scanner.Scan(base::StringPiece(body).substr(0, 20));
+  EXPECT_TRUE(scanner.is_amp_page());
+  EXPECT_FALSE(scanner.canonical_url().has_value());
+  scanner.Scan(body);
+  ASSERT_TRUE(scanner.canonical_url().has_value());
+  EXPECT_EQ("https://abc.com", scanner.canonical_url()->value());
+}
+
 TEST(DeAmpUtilUnitTest, CanonicalLinkMissingScheme) {
   CheckCheckCanonicalLinkResult("xyz.com", "https://amp.xyz.com", false);
 }
@@ -10,15 +10,12 @@
 
 #include "base/base_paths.h"
 #include "base/command_line.h"
-#include "base/containers/flat_set.h"
 #include "base/functional/bind.h"
-#include "base/json/json_reader.h"
 #include "base/logging.h"
 #include "base/task/thread_pool.h"
 #include "base/types/expected.h"
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
 #include "brave/components/brave_component_updater/browser/local_data_files_service.h"
-#include "net/base/registry_controlled_domains/registry_controlled_domain.h"
 
 using brave_component_updater::LocalDataFilesObserver;
 using brave_component_updater::LocalDataFilesService;
@@ -28,6 +25,18 @@ namespace debounce {
 const char kDebounceConfigFile[] = "debounce.json";
 const char kDebounceConfigFileVersion[] = "1";
 
+namespace {
+
+base::expected<std::pair<std::vector<std::unique_ptr<DebounceRule>>,
+                         DebounceRuleHostIndex>,
+               std::string>
+ReadAndParseRules(const base::FilePath& dat_file_path) {
+  return DebounceRule::ParseRules(
+      brave_component_updater::GetDATFileAsString(dat_file_path));
+}
+
+}  // namespace
+
 DebounceComponentInstaller::DebounceComponentInstaller(
     LocalDataFilesService* local_data_files_service)
     : LocalDataFilesObserver(local_data_files_service) {}
@@ -36,25 +45,27 @@ DebounceComponentInstaller::~DebounceComponentInstaller() = default;
 
 void DebounceComponentInstaller::LoadDirectlyFromResourcePath() {
   base::FilePath dat_file_path = resource_dir_.AppendASCII(kDebounceConfigFile);
+  // Parsing compiles the rule regexes and builds the host index, so do it on
+  // the background task as well.
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&brave_component_updater::GetDATFileAsString,
-                     dat_file_path),
-      base::BindOnce(&DebounceComponentInstaller::OnDATFileDataReady,
+      base::BindOnce(&ReadAndParseRules, dat_file_path),
+      base::BindOnce(&DebounceComponentInstaller::OnRulesParsed,
                      weak_factory_.GetWeakPtr()));
 }
 
-void DebounceComponentInstaller::OnDATFileDataReady(
-    const std::string& contents) {
-  auto parsed_rules = DebounceRule::ParseRules(contents);
+void DebounceComponentInstaller::OnRulesParsed(
+    base::expected<std::pair<std::vector<std::unique_ptr<DebounceRule>>,
+                             DebounceRuleHostIndex>,
+                   std::string> parsed_rules) {
   if (!parsed_rules.has_value()) {
     LOG(WARNING) << parsed_rules.error();
     return;
   }
-  rules_.clear();
-  host_cache_.clear();
+  // Clear the index first, it points into |rules_|.
+  host_index_.clear();
   rules_ = std::move(parsed_rules.value().first);
-  host_cache_ = parsed_rules.value().second;
+  host_index_ = std::move(parsed_rules.value().second);
   for (Observer& observer : observers_)
     observer.OnRulesReady(this);
 }
@@ -8,15 +8,16 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
-#include "base/containers/flat_set.h"
 #include "base/files/file_path.h"
 #include "base/json/json_value_converter.h"
 #include "base/memory/weak_ptr.h"
 #include "base/observer_list.h"
 #include "base/observer_list_types.h"
 #include "base/sequence_checker.h"
+#include "base/types/expected.h"
 #include "base/values.h"
 #include "brave/components/brave_component_updater/browser/local_data_files_observer.h"
 #include "brave/components/debounce/browser/debounce_rule.h"
@@ -44,7 +45,7 @@ class DebounceComponentInstaller
   const std::vector<std::unique_ptr<DebounceRule>>& rules() const {
     return rules_;
   }
-  const base::flat_set<std::string>& host_cache() const { return host_cache_; }
+  const DebounceRuleHostIndex& host_index() const { return host_index_; }
 
   // implementation of brave_component_updater::LocalDataFilesObserver
   void OnComponentReady(const std::string& component_id,
@@ -65,13 +66,16 @@ class DebounceComponentInstaller
  private:
   friend class DebounceBrowserTest;
 
-  void OnDATFileDataReady(const std::string& contents);
+  void OnRulesParsed(
+      base::expected<std::pair<std::vector<std::unique_ptr<DebounceRule>>,
+                               DebounceRuleHostIndex>,
+                     std::string> parsed_rules);
   void LoadOnTaskRunner();
   void LoadDirectlyFromResourcePath();
 
   base::ObserverList<Observer> observers_;
   std::vector<std::unique_ptr<DebounceRule>> rules_;
-  base::flat_set<std::string> host_cache_;
+  DebounceRuleHostIndex host_index_;
   base::FilePath resource_dir_;
 
   base::WeakPtrFactory<DebounceComponentInstaller> weak_factory_{this};
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "base/base64url.h"
+#include "base/containers/flat_set.h"
 #include "base/json/json_reader.h"
 #include "base/strings/escape.h"
 #include "base/strings/stringprintf.h"
@@ -139,25 +140,53 @@ DebounceRule::ParseRules(const std::string& contents) {
   if (!root) {
     return base::unexpected("Failed to parse debounce configuration");
   }
-  std::vector<std::string> hosts;
   std::vector<std::unique_ptr<DebounceRule>> rules;
+  // eTLD+1s of the include patterns of each rule, parallel to |rules|.
+  std::vector<base::flat_set<std::string>> rule_hosts;
   base::JSONValueConverter<DebounceRule> converter;
   for (base::Value& it : root->GetList()) {
     std::unique_ptr<DebounceRule> rule = std::make_unique<DebounceRule>();
     if (!converter.Convert(it, rule.get()))
       continue;
+    rule->CompileParamRegex();
+    std::vector<std::string> hosts;
     for (const URLPattern& pattern : rule->include_pattern_set()) {
-      if (!pattern.host().empty()) {
-        const std::string etldp1 =
-            DebounceRule::GetETLDForDebounce(pattern.host());
-        if (!etldp1.empty())
-          hosts.push_back(std::move(etldp1));
-      }
+      // Patterns without an eTLD+1 (e.g. "*://*/*") can match any host, so
+      // they are indexed under the empty string and added to every host.
+      hosts.push_back(pattern.host().empty()
+                          ? std::string()
+                          : DebounceRule::GetETLDForDebounce(pattern.host()));
     }
+    rule_hosts.emplace_back(std::move(hosts));
     rules.push_back(std::move(rule));
   }
+
+  // Only hosts named by some rule get an entry, as before; rules that match
+  // any host are candidates for each of them.
+  base::flat_set<std::string> hosts;
+  for (const auto& rule_host : rule_hosts) {
+    for (const auto& host : rule_host) {
+      if (!host.empty()) {
+        hosts.insert(host);
+      }
+    }
+  }
+  std::vector<std::pair<std::string, std::vector<const DebounceRule*>>>
+      index_entries;
+  index_entries.reserve(hosts.size());
+  for (const auto& host : hosts) {
+    std::vector<const DebounceRule*> host_rules;
+    for (size_t i = 0; i < rules.size(); ++i) {
+      if (rule_hosts[i].contains(host) || rule_hosts[i].contains("")) {
+        host_rules.push_back(rules[i].get());
+      }
+    }
+    index_entries.emplace_back(host, std::move(host_rules));
+  }
+
   return std::pair<std::vector<std::unique_ptr<DebounceRule>>,
-                   base::flat_set<std::string>>(std::move(rules), hosts);
+                   DebounceRuleHostIndex>(
+      std::move(rules), DebounceRuleHostIndex(std::move(index_entries)));
 }
 
 bool DebounceRule::CheckPrefForRule(const PrefService* prefs) const {
@@ -177,29 +206,38 @@ bool DebounceRule::CheckPrefForRule(const PrefService* prefs) const {
   return true;
 }
 
-bool DebounceRule::ValidateAndParsePatternRegex(
-    const std::string& pattern,
-    const std::string& path,
-    std::string* parsed_value) const {
-  if (pattern.length() > kMaxLengthRegexPattern) {
+void DebounceRule::CompileParamRegex() {
+  if (action_ != kDebounceRegexPath) {
+    return;
+  }
+  if (param_.length() > kMaxLengthRegexPattern) {
     VLOG(1) << "Debounce regex pattern exceeds max length: "
             << kMaxLengthRegexPattern;
-    return false;
+    return;
   }
   re2::RE2::Options options;
   options.set_max_mem(kMaxMemoryPerRegexPattern);
-  const re2::RE2 pattern_regex(pattern, options);
+  auto pattern_regex = std::make_unique<re2::RE2>(param_, options);
 
-  if (!pattern_regex.ok()) {
-    VLOG(1) << "Debounce rule has param: " << pattern
+  if (!pattern_regex->ok()) {
+    VLOG(1) << "Debounce rule has param: " << param_
             << " which is an invalid regex pattern";
-    return false;
+    return;
   }
-  if (pattern_regex.NumberOfCapturingGroups() < 1) {
-    VLOG(1) << "Debounce rule has param: " << pattern
+  if (pattern_regex->NumberOfCapturingGroups() < 1) {
+    VLOG(1) << "Debounce rule has param: " << param_
             << " which captures < 1 groups";
+    return;
+  }
+  param_regex_ = std::move(pattern_regex);
+}
+
+bool DebounceRule::ParsePatternRegex(const std::string& path,
+                                     std::string* parsed_value) const {
+  if (!param_regex_) {
     return false;
   }
+  const re2::RE2& pattern_regex = *param_regex_;
 
   // Get matching capture groups by applying regex to the path
   size_t number_of_capturing_groups =
@@ -258,7 +296,7 @@ bool DebounceRule::Apply(const GURL& original_url,
     // Important: Apply param regex to ONLY the path of original URL.
     auto path = original_url.path();
 
-    if (!ValidateAndParsePatternRegex(param_, path, &unescaped_value)) {
+    if (!ParsePatternRegex(path, &unescaped_value)) {
       VLOG(1) << "Debounce regex parsing failed";
       return false;
     }
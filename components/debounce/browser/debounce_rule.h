@@ -11,7 +11,7 @@
 #include <utility>
 #include <vector>
 
-#include "base/containers/flat_set.h"
+#include "base/containers/flat_map.h"
 #include "base/json/json_value_converter.h"
 #include "base/strings/escape.h"
 #include "base/types/expected.h"
@@ -21,8 +21,18 @@
 
 class GURL;
 
+namespace re2 {
+class RE2;
+}  // namespace re2
+
 namespace debounce {
 
+class DebounceRule;
+
+// Maps an eTLD+1 to the rules that may apply to URLs on it, in rule order.
+using DebounceRuleHostIndex =
+    base::flat_map<std::string, std::vector<const DebounceRule*>>;
+
 enum DebounceAction {
   kDebounceNoAction,
   kDebounceRedirectToParam,
@@ -49,8 +59,10 @@ class DebounceRule {
                                   DebounceAction* field);
   static bool ParsePrependScheme(base::StringPiece value,
                                  DebouncePrependScheme* field);
+  // Parses the rules, precompiling their regexes, and indexes them by the
+  // eTLD+1 of their include patterns.
   static base::expected<std::pair<std::vector<std::unique_ptr<DebounceRule>>,
-                                  base::flat_set<std::string>>,
+                                  DebounceRuleHostIndex>,
                         std::string>
   ParseRules(const std::string& contents);
   static const std::string GetETLDForDebounce(const std::string& host);
@@ -67,15 +79,17 @@ class DebounceRule {
 
  private:
   bool CheckPrefForRule(const PrefService* prefs) const;
-  bool ValidateAndParsePatternRegex(const std::string& pattern,
-                                    const std::string& path,
-                                    std::string* parsed_value) const;
+  void CompileParamRegex();
+  bool ParsePatternRegex(const std::string& path,
+                         std::string* parsed_value) const;
   extensions::URLPatternSet include_pattern_set_;
   extensions::URLPatternSet exclude_pattern_set_;
   DebounceAction action_;
   DebouncePrependScheme prepend_scheme_;
   std::string param_;
   std::string pref_;
+  // Compiled from |param_| for kDebounceRegexPath rules, null if invalid.
+  std::unique_ptr<re2::RE2> param_regex_;
 };
 
 }  // namespace debounce
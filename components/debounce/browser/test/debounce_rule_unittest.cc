@@ -445,4 +445,44 @@ TEST(DebounceRuleUnitTest, CatchMultiplePathsForSameInclude) {
   }
 }
 
+TEST(DebounceRuleUnitTest, HostIndex) {
+  const std::string contents = R"json(
+      [{
+          "include": [
+              "*://*.test.com/*",
+              "*://other.test.co.uk/*"
+          ],
+          "action": "redirect",
+          "param": "url"
+      }, {
+          "include": [
+              "*://*/*"
+          ],
+          "action": "redirect",
+          "param": "dest"
+      }, {
+          "include": [
+              "*://brave.com/*"
+          ],
+          "action": "redirect",
+          "param": "url"
+      }]
+      )json";
+  auto parsed = DebounceRule::ParseRules(contents);
+  ASSERT_TRUE(parsed.has_value());
+  const auto& rules = parsed.value().first;
+  const DebounceRuleHostIndex& host_index = parsed.value().second;
+  ASSERT_EQ(3u, rules.size());
+
+  // Only hosts named by a rule are indexed; rules matching any host are
+  // candidates on each of them, in rule order.
+  EXPECT_EQ(3u, host_index.size());
+  EXPECT_EQ(host_index.at("test.com"),
+            std::vector<const DebounceRule*>({rules[0].get(), rules[1].get()}));
+  EXPECT_EQ(host_index.at("test.co.uk"),
+            std::vector<const DebounceRule*>({rules[0].get(), rules[1].get()}));
+  EXPECT_EQ(host_index.at("brave.com"),
+            std::vector<const DebounceRule*>({rules[1].get(), rules[2].get()}));
+}
+
 }  // namespace debounce
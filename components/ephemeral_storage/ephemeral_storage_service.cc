@@ -5,6 +5,8 @@
 
 #include "brave/components/ephemeral_storage/ephemeral_storage_service.h"
 
+#include <algorithm>
+#include <string>
 #include <utility>
 
 #include "base/task/sequenced_task_runner.h"
@@ -28,6 +30,11 @@ namespace ephemeral_storage {
 
 namespace {
 
+// Origins due to be cleaned up within this window of the earliest one are
+// cleaned up together.
+constexpr base::TimeDelta kFirstPartyStorageAreasCleanupBatchWindow =
+    base::Seconds(1);
+
 bool IsOriginAcceptableForFirstPartyStorageCleanup(const url::Origin& origin) {
   return !origin.opaque() && (origin.scheme() == url::kHttpScheme ||
                               origin.scheme() == url::kHttpsScheme);
@@ -151,6 +158,8 @@ void EphemeralStorageService::FirstPartyStorageAreaInUse(
     return;
   }
 
+  ScheduleFirstPartyStorageAreasCleanup();
+
   ScopedListPrefUpdate pref_update(user_prefs::UserPrefs::Get(context_),
                                    kFirstPartyStorageOriginsToCleanup);
   pref_update->EraseValue(base::Value(origin.Serialize()));
@@ -174,14 +183,15 @@ void EphemeralStorageService::FirstPartyStorageAreaNotInUse(
     return;
   }
 
-  auto cleanup_timer = std::make_unique<base::OneShotTimer>();
-  cleanup_timer->Start(
-      FROM_HERE, first_party_storage_areas_keep_alive_,
-      base::BindOnce(
-          &EphemeralStorageService::CleanupFirstPartyStorageAreaByTimer,
-          weak_ptr_factory_.GetWeakPtr(), origin));
-  first_party_storage_areas_to_cleanup_.emplace(origin,
-                                                std::move(cleanup_timer));
+  if (!first_party_storage_areas_to_cleanup_
+           .emplace(origin, base::TimeTicks::Now() +
+                                first_party_storage_areas_keep_alive_)
+           .second) {
+    return;
+  }
+
+  ScheduleFirstPartyStorageAreasCleanup();
+
   ScopedListPrefUpdate pref_update(user_prefs::UserPrefs::Get(context_),
                                    kFirstPartyStorageOriginsToCleanup);
   pref_update->Append(base::Value(origin.Serialize()));
@@ -190,6 +200,7 @@ void EphemeralStorageService::FirstPartyStorageAreaNotInUse(
 void EphemeralStorageService::CleanupFirstPartyStorageAreasOnStartup() {
   ScopedListPrefUpdate urls_to_cleanup(user_prefs::UserPrefs::Get(context_),
                                        kFirstPartyStorageOriginsToCleanup);
+  std::vector<url::Origin> origins;
   for (const auto& url_to_cleanup : urls_to_cleanup.Get()) {
     const auto* url_string = url_to_cleanup.GetIfString();
     if (!url_string) {
@@ -199,27 +210,73 @@ void EphemeralStorageService::CleanupFirstPartyStorageAreasOnStartup() {
     if (!url.is_valid()) {
       continue;
     }
-    CleanupFirstPartyStorageArea(url::Origin::Create(url));
+    origins.push_back(url::Origin::Create(url));
   }
+  CleanupFirstPartyStorageAreas(origins);
   urls_to_cleanup->clear();
 }
 
-void EphemeralStorageService::CleanupFirstPartyStorageAreaByTimer(
-    const url::Origin& origin) {
-  DCHECK(base::Contains(first_party_storage_areas_to_cleanup_, origin));
+void EphemeralStorageService::ScheduleFirstPartyStorageAreasCleanup() {
+  if (first_party_storage_areas_to_cleanup_.empty()) {
+    first_party_storage_areas_cleanup_timer_.Stop();
+    return;
+  }
 
-  CleanupFirstPartyStorageArea(origin);
+  base::TimeTicks cleanup_time = base::TimeTicks::Max();
+  for (const auto& [origin, origin_cleanup_time] :
+       first_party_storage_areas_to_cleanup_) {
+    cleanup_time = std::min(cleanup_time, origin_cleanup_time);
+  }
 
-  first_party_storage_areas_to_cleanup_.erase(origin);
-  ScopedListPrefUpdate pref_update(user_prefs::UserPrefs::Get(context_),
-                                   kFirstPartyStorageOriginsToCleanup);
-  pref_update->EraseValue(base::Value(origin.Serialize()));
+  if (first_party_storage_areas_cleanup_timer_.IsRunning() &&
+      first_party_storage_areas_cleanup_timer_.desired_run_time() ==
+          cleanup_time) {
+    return;
+  }
+
+  first_party_storage_areas_cleanup_timer_.Start(
+      FROM_HERE, cleanup_time - base::TimeTicks::Now(),
+      base::BindOnce(
+          &EphemeralStorageService::CleanupFirstPartyStorageAreasByTimer,
+          weak_ptr_factory_.GetWeakPtr()));
 }
 
-void EphemeralStorageService::CleanupFirstPartyStorageArea(
-    const url::Origin& origin) {
+void EphemeralStorageService::CleanupFirstPartyStorageAreasByTimer() {
+  const base::TimeTicks cleanup_time =
+      base::TimeTicks::Now() + kFirstPartyStorageAreasCleanupBatchWindow;
+
+  std::vector<url::Origin> origins;
+  for (auto it = first_party_storage_areas_to_cleanup_.begin();
+       it != first_party_storage_areas_to_cleanup_.end();) {
+    if (it->second > cleanup_time) {
+      ++it;
+      continue;
+    }
+    origins.push_back(it->first);
+    it = first_party_storage_areas_to_cleanup_.erase(it);
+  }
+
+  CleanupFirstPartyStorageAreas(origins);
+
+  if (!origins.empty()) {
+    ScopedListPrefUpdate pref_update(user_prefs::UserPrefs::Get(context_),
+                                     kFirstPartyStorageOriginsToCleanup);
+    for (const auto& origin : origins) {
+      pref_update->EraseValue(base::Value(origin.Serialize()));
+    }
+  }
+
+  ScheduleFirstPartyStorageAreasCleanup();
+}
+
+void EphemeralStorageService::CleanupFirstPartyStorageAreas(
+    const std::vector<url::Origin>& origins) {
   DCHECK(base::FeatureList::IsEnabled(
       net::features::kBraveForgetFirstPartyStorage));
+  if (origins.empty()) {
+    return;
+  }
+
   content::BrowsingDataRemover* remover = context_->GetBrowsingDataRemover();
   content::BrowsingDataRemover::DataType data_to_remove =
       content::BrowsingDataRemover::DATA_TYPE_DOM_STORAGE;
@@ -228,17 +285,29 @@ void EphemeralStorageService::CleanupFirstPartyStorageArea(
       content::BrowsingDataRemover::ORIGIN_TYPE_PROTECTED_WEB;
   auto filter_builder = content::BrowsingDataFilterBuilder::Create(
       content::BrowsingDataFilterBuilder::Mode::kDelete);
-  filter_builder->AddOrigin(origin);
+  // Cookies are deleted per storage partition, so group the hosts to delete
+  // cookies for by the partition they live in.
+  std::map<content::StoragePartition*, std::vector<std::string>>
+      cookie_domains_by_storage_partition;
+  for (const auto& origin : origins) {
+    filter_builder->AddOrigin(origin);
+
+    const auto& url = net::SchemefulSite(origin).GetURL();
+    auto site_instance = content::SiteInstance::CreateForURL(context_, url);
+    auto* storage_partition =
+        context_->GetStoragePartition(site_instance.get());
+    if (storage_partition) {
+      cookie_domains_by_storage_partition[storage_partition].push_back(
+          url.host());
+    }
+  }
   remover->RemoveWithFilter(base::Time(), base::Time::Max(), data_to_remove,
                             origin_type, std::move(filter_builder));
 
-  const auto& url = net::SchemefulSite(origin).GetURL();
-  auto cookie_deletion_filter = network::mojom::CookieDeletionFilter::New();
-  cookie_deletion_filter->including_domains.emplace({url.host()});
-
-  auto site_instance = content::SiteInstance::CreateForURL(context_, url);
-  auto* storage_partition = context_->GetStoragePartition(site_instance.get());
-  if (storage_partition) {
+  for (auto& [storage_partition, domains] :
+       cookie_domains_by_storage_partition) {
+    auto cookie_deletion_filter = network::mojom::CookieDeletionFilter::New();
+    cookie_deletion_filter->including_domains = std::move(domains);
     storage_partition->GetCookieManagerForBrowserProcess()->DeleteCookies(
         std::move(cookie_deletion_filter), base::NullCallback());
   }
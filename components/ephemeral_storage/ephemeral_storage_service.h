@@ -8,6 +8,7 @@
 
 #include <map>
 #include <memory>
+#include <vector>
 
 #include "base/containers/flat_set.h"
 #include "base/functional/callback.h"
@@ -67,8 +68,11 @@ class EphemeralStorageService : public KeyedService {
   // startup. It's impossible to do a cleanup on shutdown, because the process
   // is asynchronous and cannot block the browser shutdown.
   void CleanupFirstPartyStorageAreasOnStartup();
-  void CleanupFirstPartyStorageAreaByTimer(const url::Origin& origin);
-  void CleanupFirstPartyStorageArea(const url::Origin& origin);
+  // Closing a window usually makes many origins unused at once, so a single
+  // timer cleans up every origin due within a short window in one batch.
+  void ScheduleFirstPartyStorageAreasCleanup();
+  void CleanupFirstPartyStorageAreasByTimer();
+  void CleanupFirstPartyStorageAreas(const std::vector<url::Origin>& origins);
 
   raw_ptr<content::BrowserContext> context_ = nullptr;
   raw_ptr<HostContentSettingsMap> host_content_settings_map_ = nullptr;
@@ -76,8 +80,9 @@ class EphemeralStorageService : public KeyedService {
   base::flat_set<ContentSettingsPattern> patterns_to_cleanup_on_shutdown_;
 
   base::TimeDelta first_party_storage_areas_keep_alive_;
-  std::map<url::Origin, std::unique_ptr<base::OneShotTimer>>
-      first_party_storage_areas_to_cleanup_;
+  // Maps origins to the time at which they should be cleaned up.
+  std::map<url::Origin, base::TimeTicks> first_party_storage_areas_to_cleanup_;
+  base::OneShotTimer first_party_storage_areas_cleanup_timer_;
 
   base::WeakPtrFactory<EphemeralStorageService> weak_ptr_factory_{this};
 };
@@ -8,6 +8,15 @@
 
 namespace brave_wallet {
 
+namespace {
+
+std::string SanitizeJson(const std::string& json) {
+  return std::string(json::sanitize_json(rust::Slice<const uint8_t>(
+      reinterpret_cast<const uint8_t*>(json.data()), json.size())));
+}
+
+}  // namespace
+
 TEST(JsonParser, ConvertUint64ToString) {
   std::string json = "{\"a\": " + std::to_string(UINT64_MAX) + "}";
   EXPECT_EQ(
@@ -599,4 +608,19 @@ TEST(JsonParser, ConvertAllNumbersToString) {
   }
 }
 
+TEST(JsonParser, SanitizeJson) {
+  EXPECT_EQ(SanitizeJson(R"( { "b" : 1, "a" : [ true, null, "x" ] } )"),
+            R"({"a":[true,null,"x"],"b":1})");
+  EXPECT_EQ(SanitizeJson("{\"a\":18446744073709551615}"),
+            R"({"a":18446744073709551615})");
+  EXPECT_EQ(SanitizeJson("0"), "0");
+
+  std::vector<std::string> invalid_cases = {
+      "", "{", "a", R"({"a":1,})", "{\"a\":\"\xff\"}",
+      std::string(200, '[') + std::string(200, ']')};
+  for (const auto& invalid_case : invalid_cases) {
+    EXPECT_EQ("", SanitizeJson(invalid_case)) << invalid_case;
+  }
+}
+
 }  // namespace brave_wallet
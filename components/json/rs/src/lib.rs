@@ -12,6 +12,7 @@ mod ffi {
             json: &str,
         ) -> String;
         fn convert_all_numbers_to_string(json: &str) -> String;
+        fn sanitize_json(json: &[u8]) -> String;
     }
 }
 
@@ -275,3 +276,23 @@ pub fn convert_all_numbers_to_string(json: &str) -> String {
         })
         .unwrap_or_else(|_| "".into())
 }
+
+/// Parses and re-serializes json, so that untrusted input only ever reaches
+/// this memory-safe parser and other parsers receive well-formed JSON.
+///
+/// Returns an empty String if `json` is not valid UTF-8, not valid JSON or
+/// nested too deeply.
+///
+/// # Arguments
+/// * `json` - A arbitrary JSON string
+///
+/// # Examples
+///
+/// ```js
+/// { "b" : 1, "a" : [ true ] } -> {"a":[true],"b":1}
+/// ```
+pub fn sanitize_json(json: &[u8]) -> String {
+    serde_json::from_slice(json)
+        .map(|v: serde_json::Value| v.to_string())
+        .unwrap_or_else(|_| "".into())
+}
@@ -29,6 +29,7 @@ constexpr base::TimeDelta kPagesLoadedReportInterval = base::Minutes(30);
 constexpr base::TimeDelta kDomainsLoadedReportInterval = base::Minutes(30);
 constexpr base::TimeDelta kPagesLoadedInitReportDelay = base::Seconds(30);
 constexpr base::TimeDelta kDomainsLoadedInitReportDelay = base::Seconds(30);
+constexpr base::TimeDelta kPagesLoadedFlushDelay = base::Minutes(1);
 
 }  // namespace
 
@@ -61,12 +62,17 @@ void PageMetricsService::RegisterPrefs(PrefRegistrySimple* registry) {
 void PageMetricsService::IncrementPagesLoadedCount() {
   VLOG(2) << "PageMetricsService: increment page load count";
   if (pages_loaded_storage_ == nullptr) {
-    pages_loaded_storage_ = std::make_unique<WeeklyStorage>(
-        local_state_, kMiscMetricsPagesLoadedCount);
+    InitPagesLoadedStorage();
   }
   pages_loaded_storage_->AddDelta(1);
 }
 
+void PageMetricsService::InitPagesLoadedStorage() {
+  pages_loaded_storage_ = std::make_unique<WeeklyStorage>(
+      local_state_, kMiscMetricsPagesLoadedCount);
+  pages_loaded_storage_->EnableBufferedWrites(kPagesLoadedFlushDelay);
+}
+
 void PageMetricsService::ReportDomainsLoaded() {
   // Derived from current profile history.
   // Mutiple profiles will result in metric overwrites which is okay.
@@ -82,8 +88,7 @@ void PageMetricsService::ReportPagesLoaded() {
   // Stores a global count in local state to
   // capture page loads across all profiles.
   if (pages_loaded_storage_ == nullptr) {
-    pages_loaded_storage_ = std::make_unique<WeeklyStorage>(
-        local_state_, kMiscMetricsPagesLoadedCount);
+    InitPagesLoadedStorage();
   }
   uint64_t count = pages_loaded_storage_->GetPeriodSum();
   p3a_utils::RecordToHistogramBucket(kPagesLoadedHistogramName,
@@ -38,6 +38,7 @@ class PageMetricsService : public KeyedService {
   void IncrementPagesLoadedCount();
 
  private:
+  void InitPagesLoadedStorage();
   void ReportDomainsLoaded();
   void ReportPagesLoaded();
 
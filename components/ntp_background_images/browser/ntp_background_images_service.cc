@@ -42,6 +42,8 @@ namespace {
 constexpr int kSIComponentUpdateCheckIntervalMins = 15;
 constexpr char kNTPManifestFile[] = "photo.json";
 constexpr char kNTPSRMappingTableFile[] = "mapping-table.json";
+// Enough for the current wallpapers plus a sponsored campaign's images.
+constexpr size_t kMaxImageDataCacheSize = 32 * 1024 * 1024;
 
 constexpr char kNTPSRMappingTableComponentPublicKey[] = "MIIBIjANBgkqhkiG9w0BAQEFAAOCAQ8AMIIBCgKCAQEAp7IWv7wzH/KLrxx7BKWOIIUMDylQNzxwM5Fig2WHc16BoMW9Kaya/g17Bpfp0YIvxdcmDBcB9kFALqQLxi1WQfa9d7YxqcmAGUKo407RMwEa6dQVkIPMFz2ZPGSfFgr526gYOqWh3Q4h8oN94qxBLgFyT25SMK5zQDGyq96ntME4MQRNwpDBUv7DDK7Npwe9iE8cBgzYTvf0taAFn2ZZi1RhS0RzpdynucpKosnc0sVBLTXy+HDvnMr+77T48zM0YmpjIh8Qmrp9CNbKzZUsZzNfnHpL9IZnjwQ51EOYdPGX2r1obChVZN19HzpK5scZEMRKoCMfCepWpEkMSIoPzQIDAQAB";  // NOLINT
 constexpr char kNTPSRMappingTableComponentID[] =
@@ -465,6 +467,7 @@ void NTPBackgroundImagesService::OnComponentReady(
 
 void NTPBackgroundImagesService::OnGetComponentJsonData(
     const std::string& json_string) {
+  ClearImageDataCache();
   bi_images_data_ =
       std::make_unique<NTPBackgroundImagesData>(json_string, bi_installed_dir_);
 
@@ -495,6 +498,7 @@ void NTPBackgroundImagesService::OnSponsoredComponentReady(
 void NTPBackgroundImagesService::OnGetSponsoredComponentJsonData(
     bool is_super_referral,
     const std::string& json_string) {
+  ClearImageDataCache();
   if (is_super_referral) {
     local_pref_->SetBoolean(
           prefs::kNewTabPageGetInitialSRComponentInProgress,
@@ -527,6 +531,42 @@ void NTPBackgroundImagesService::OnGetSponsoredComponentJsonData(
   }
 }
 
+scoped_refptr<base::RefCountedMemory>
+NTPBackgroundImagesService::GetCachedImageData(
+    const base::FilePath& image_file_path) {
+  auto it = image_data_cache_.Get(image_file_path);
+  if (it == image_data_cache_.end())
+    return nullptr;
+  return it->second;
+}
+
+void NTPBackgroundImagesService::CacheImageData(
+    const base::FilePath& image_file_path,
+    scoped_refptr<base::RefCountedMemory> data) {
+  if (!data || data->size() > kMaxImageDataCacheSize)
+    return;
+
+  auto it = image_data_cache_.Peek(image_file_path);
+  if (it != image_data_cache_.end()) {
+    image_data_cache_size_ -= it->second->size();
+    image_data_cache_.Erase(it);
+  }
+
+  while (image_data_cache_size_ + data->size() > kMaxImageDataCacheSize) {
+    auto oldest = image_data_cache_.rbegin();
+    image_data_cache_size_ -= oldest->second->size();
+    image_data_cache_.Erase(oldest);
+  }
+
+  image_data_cache_size_ += data->size();
+  image_data_cache_.Put(image_file_path, std::move(data));
+}
+
+void NTPBackgroundImagesService::ClearImageDataCache() {
+  image_data_cache_.Clear();
+  image_data_cache_size_ = 0;
+}
+
 void NTPBackgroundImagesService::MarkThisInstallIsNotSuperReferralForever() {
   local_pref_->SetDict(prefs::kNewTabPageCachedSuperReferralComponentInfo,
                        base::Value::Dict());
@@ -10,9 +10,12 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/lru_cache.h"
 #include "base/files/file_path.h"
 #include "base/gtest_prod_util.h"
 #include "base/memory/raw_ptr.h"
+#include "base/memory/ref_counted_memory.h"
+#include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/observer_list.h"
 #include "base/timer/timer.h"
@@ -72,7 +75,20 @@ class NTPBackgroundImagesService {
 
   void CheckNTPSIComponentUpdateIfNeeded();
 
+  // In-memory cache of image file contents served by the NTP data sources,
+  // so that opening a New Tab Page doesn't re-read the same wallpaper from
+  // disk. Component versions are installed into their own directories, so
+  // |image_file_path| also identifies the version. The cache is cleared
+  // whenever a component is updated.
+  scoped_refptr<base::RefCountedMemory> GetCachedImageData(
+      const base::FilePath& image_file_path);
+  void CacheImageData(const base::FilePath& image_file_path,
+                      scoped_refptr<base::RefCountedMemory> data);
+
  private:
+  using ImageDataCache =
+      base::LRUCache<base::FilePath, scoped_refptr<base::RefCountedMemory>>;
+
   friend class TestNTPBackgroundImagesService;
   friend class NTPBackgroundImagesServiceTest;
   friend class NTPBackgroundImagesViewCounterTest;
@@ -120,6 +136,7 @@ class NTPBackgroundImagesService {
   FRIEND_TEST_ALL_PREFIXES(NTPBackgroundImagesSourceTest,
                            BasicSuperReferralDataTest);
   FRIEND_TEST_ALL_PREFIXES(NTPBackgroundImagesSourceTest, BackgroundImagesTest);
+  FRIEND_TEST_ALL_PREFIXES(NTPBackgroundImagesSourceTest, ImageDataCacheTest);
   FRIEND_TEST_ALL_PREFIXES(NTPBackgroundImagesViewCounterTest,
                            GetCurrentWallpaperTest);
 
@@ -138,6 +155,7 @@ class NTPBackgroundImagesService {
       const base::Value::Dict& component_info) const;
 
   void CheckImagesComponentUpdate(const std::string& component_id);
+  void ClearImageDataCache();
 
   // virtual for test.
   virtual void CheckSuperReferralComponent();
@@ -176,6 +194,9 @@ class NTPBackgroundImagesService {
   // not show SI images until user chooses Brave default images. So, we should
   // know the exact timing whether SR assets is ready to use or not.
   absl::optional<base::Value::Dict> initial_sr_component_info_;
+  // Bounded by |image_data_cache_size_| rather than by entry count.
+  ImageDataCache image_data_cache_{ImageDataCache::NO_AUTO_EVICT};
+  size_t image_data_cache_size_ = 0;
   base::WeakPtrFactory<NTPBackgroundImagesService> weak_factory_;
 };
 
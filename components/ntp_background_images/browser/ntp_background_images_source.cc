@@ -71,22 +71,29 @@ void NTPBackgroundImagesSource::StartDataRequest(
 void NTPBackgroundImagesSource::GetImageFile(
     const base::FilePath& image_file_path,
     GotDataCallback callback) {
+  if (auto cached_data = service_->GetCachedImageData(image_file_path)) {
+    std::move(callback).Run(std::move(cached_data));
+    return;
+  }
+
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
       base::BindOnce(&ReadFileToString, image_file_path),
       base::BindOnce(&NTPBackgroundImagesSource::OnGotImageFile,
-                     weak_factory_.GetWeakPtr(), std::move(callback)));
+                     weak_factory_.GetWeakPtr(), image_file_path,
+                     std::move(callback)));
 }
 
 void NTPBackgroundImagesSource::OnGotImageFile(
+    const base::FilePath& image_file_path,
     GotDataCallback callback,
     absl::optional<std::string> input) {
   if (!input)
     return;
 
-  scoped_refptr<base::RefCountedMemory> bytes;
-  bytes = new base::RefCountedBytes(
-       reinterpret_cast<const unsigned char*>(input->c_str()), input->length());
+  scoped_refptr<base::RefCountedMemory> bytes =
+      base::MakeRefCounted<base::RefCountedString>(std::move(*input));
+  service_->CacheImageData(image_file_path, bytes);
   std::move(callback).Run(std::move(bytes));
 }
 
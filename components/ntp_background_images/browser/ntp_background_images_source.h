@@ -36,6 +36,7 @@ class NTPBackgroundImagesSource : public content::URLDataSource {
   FRIEND_TEST_ALL_PREFIXES(NTPBackgroundImagesSourceTest, BackgroundImagesTest);
   FRIEND_TEST_ALL_PREFIXES(NTPBackgroundImagesSourceTest,
                            BackgroundImagesFormatTest);
+  FRIEND_TEST_ALL_PREFIXES(NTPBackgroundImagesSourceTest, ImageDataCacheTest);
 
   // content::URLDataSource overrides:
   std::string GetSource() override;
@@ -46,7 +47,8 @@ class NTPBackgroundImagesSource : public content::URLDataSource {
 
   void GetImageFile(const base::FilePath& image_file_path,
                     GotDataCallback callback);
-  void OnGotImageFile(GotDataCallback callback,
+  void OnGotImageFile(const base::FilePath& image_file_path,
+                      GotDataCallback callback,
                       absl::optional<std::string> input);
   int GetWallpaperIndexFromPath(const std::string& path) const;
 
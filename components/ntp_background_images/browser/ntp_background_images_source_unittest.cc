@@ -6,6 +6,10 @@
 #include <memory>
 #include <string>
 
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/memory/ref_counted_memory.h"
+#include "base/test/bind.h"
 #include "base/test/task_environment.h"
 #include "brave/components/brave_referrals/browser/brave_referrals_service.h"
 #include "brave/components/ntp_background_images/browser/ntp_background_images_data.h"
@@ -35,7 +39,7 @@ class NTPBackgroundImagesSourceTest : public testing::Test {
                         base::Value::Dict());
   }
 
-  base::test::SingleThreadTaskEnvironment task_environment;
+  base::test::TaskEnvironment task_environment;
   TestingPrefServiceSimple local_pref_;
   std::unique_ptr<NTPBackgroundImagesService> service_;
   std::unique_ptr<NTPSponsoredImagesSource> source_;
@@ -146,6 +150,42 @@ TEST_F(NTPBackgroundImagesSourceTest, BackgroundImagesTest) {
   EXPECT_EQ(-1, bg_source_->GetWallpaperIndexFromPath("wallpaper-3.jpg"));
 }
 
+TEST_F(NTPBackgroundImagesSourceTest, ImageDataCacheTest) {
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  const base::FilePath image_file_path =
+      temp_dir.GetPath().AppendASCII("brave-bg-1.webp");
+  ASSERT_TRUE(base::WriteFile(image_file_path, "image data"));
+
+  std::string image_data;
+  auto get_image_file = [&]() {
+    image_data.clear();
+    bg_source_->GetImageFile(
+        image_file_path,
+        base::BindLambdaForTesting(
+            [&](scoped_refptr<base::RefCountedMemory> bytes) {
+              ASSERT_TRUE(bytes);
+              image_data = std::string(bytes->front_as<char>(), bytes->size());
+            }));
+    task_environment.RunUntilIdle();
+  };
+
+  get_image_file();
+  EXPECT_EQ("image data", image_data);
+  EXPECT_TRUE(service_->GetCachedImageData(image_file_path));
+
+  // Served from memory once cached.
+  ASSERT_TRUE(base::DeleteFile(image_file_path));
+  get_image_file();
+  EXPECT_EQ("image data", image_data);
+
+  // Component updates drop the cached images.
+  service_->OnGetComponentJsonData("{}");
+  EXPECT_FALSE(service_->GetCachedImageData(image_file_path));
+  get_image_file();
+  EXPECT_TRUE(image_data.empty());
+}
+
 #if !BUILDFLAG(IS_LINUX)
 TEST_F(NTPBackgroundImagesSourceTest, BasicSuperReferralDataTest) {
   // Valid super referral component json data.
@@ -76,22 +76,29 @@ void NTPSponsoredImagesSource::StartDataRequest(
 void NTPSponsoredImagesSource::GetImageFile(
     const base::FilePath& image_file_path,
     GotDataCallback callback) {
+  if (auto cached_data = service_->GetCachedImageData(image_file_path)) {
+    std::move(callback).Run(std::move(cached_data));
+    return;
+  }
+
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
       base::BindOnce(&ReadFileToString, image_file_path),
       base::BindOnce(&NTPSponsoredImagesSource::OnGotImageFile,
-                     weak_factory_.GetWeakPtr(), std::move(callback)));
+                     weak_factory_.GetWeakPtr(), image_file_path,
+                     std::move(callback)));
 }
 
 void NTPSponsoredImagesSource::OnGotImageFile(
+    const base::FilePath& image_file_path,
     GotDataCallback callback,
     absl::optional<std::string> input) {
   if (!input)
     return;
 
-  scoped_refptr<base::RefCountedMemory> bytes;
-  bytes = new base::RefCountedBytes(
-      reinterpret_cast<const unsigned char*>(input->c_str()), input->length());
+  scoped_refptr<base::RefCountedMemory> bytes =
+      base::MakeRefCounted<base::RefCountedString>(std::move(*input));
+  service_->CacheImageData(image_file_path, bytes);
   std::move(callback).Run(std::move(bytes));
 }
 
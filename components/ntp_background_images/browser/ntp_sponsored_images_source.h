@@ -47,7 +47,8 @@ class NTPSponsoredImagesSource : public content::URLDataSource {
   base::FilePath GetLocalFilePathFor(const std::string& path);
   void GetImageFile(const base::FilePath& image_file_path,
                     GotDataCallback callback);
-  void OnGotImageFile(GotDataCallback callback,
+  void OnGotImageFile(const base::FilePath& image_file_path,
+                      GotDataCallback callback,
                       absl::optional<std::string> input);
   bool IsValidPath(const std::string& path) const;
 
@@ -16,6 +16,7 @@
 #include "base/functional/bind.h"
 #include "base/logging.h"
 #include "base/metrics/histogram_macros.h"
+#include "base/time/time.h"
 #include "brave/components/brave_ads/browser/ads_service.h"
 #include "brave/components/brave_ads/common/interfaces/ads.mojom.h"
 #include "brave/components/brave_ads/common/pref_names.h"
@@ -43,6 +44,8 @@ constexpr char kNewTabsCreated[] = "brave.new_tab_page.p3a_new_tabs_created";
 constexpr char kSponsoredNewTabsCreated[] =
     "brave.new_tab_page.p3a_sponsored_new_tabs_created";
 
+constexpr base::TimeDelta kNewTabCountFlushDelay = base::Minutes(1);
+
 }  // namespace
 
 namespace ntp_background_images {
@@ -88,6 +91,8 @@ ViewCounterService::ViewCounterService(
       std::make_unique<WeeklyStorage>(local_state, kNewTabsCreated);
   branded_new_tab_count_state_ =
       std::make_unique<WeeklyStorage>(local_state, kSponsoredNewTabsCreated);
+  new_tab_count_state_->EnableBufferedWrites(kNewTabCountFlushDelay);
+  branded_new_tab_count_state_->EnableBufferedWrites(kNewTabCountFlushDelay);
 
   ResetModel();
 
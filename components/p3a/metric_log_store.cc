@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "base/check_op.h"
+#include "base/location.h"
 #include "base/logging.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/rand_util.h"
@@ -29,6 +30,8 @@ constexpr char kLogValueKey[] = "value";
 constexpr char kLogSentKey[] = "sent";
 constexpr char kLogTimestampKey[] = "timestamp";
 
+constexpr base::TimeDelta kPersistValuesDelay = base::Seconds(10);
+
 void RecordSentAnswersCount(uint64_t answers_count) {
   int answer = 0;
   if (1 <= answers_count && answers_count < 5) {
@@ -74,7 +77,9 @@ MetricLogStore::MetricLogStore(Delegate* delegate,
   DCHECK(local_state);
 }
 
-MetricLogStore::~MetricLogStore() = default;
+MetricLogStore::~MetricLogStore() {
+  PersistPendingValues();
+}
 
 void MetricLogStore::RegisterPrefs(PrefRegistrySimple* registry) {
   registry->RegisterDictionaryPref(kTypicalJsonLogPrefName);
@@ -98,6 +103,36 @@ const char* MetricLogStore::GetPrefName() const {
   }
 }
 
+void MetricLogStore::SchedulePersistValues() {
+  if (!persist_values_timer_.IsRunning()) {
+    persist_values_timer_.Start(FROM_HERE, kPersistValuesDelay, this,
+                                &MetricLogStore::PersistPendingValues);
+  }
+}
+
+void MetricLogStore::PersistPendingValues() {
+  if (pending_value_updates_.empty()) {
+    return;
+  }
+  ScopedDictPrefUpdate update(local_state_, GetPrefName());
+  WritePendingValues(&update);
+}
+
+void MetricLogStore::WritePendingValues(ScopedDictPrefUpdate* update) {
+  persist_values_timer_.Stop();
+  for (const std::string& histogram_name : pending_value_updates_) {
+    auto log_iter = log_.find(histogram_name);
+    if (log_iter == log_.end()) {
+      (*update)->Remove(histogram_name);
+      continue;
+    }
+    base::Value::Dict* log_dict = (*update)->EnsureDict(histogram_name);
+    log_dict->Set(kLogValueKey, base::NumberToString(log_iter->second.value));
+    log_dict->Set(kLogSentKey, log_iter->second.sent);
+  }
+  pending_value_updates_.clear();
+}
+
 void MetricLogStore::UpdateValue(const std::string& histogram_name,
                                  uint64_t value) {
   if (is_constellation_) {
@@ -115,19 +150,16 @@ void MetricLogStore::UpdateValue(const std::string& histogram_name,
     unsent_entries_.insert(histogram_name);
   }
 
-  // Update the persistent value.
-  ScopedDictPrefUpdate update(local_state_, GetPrefName());
-  base::Value::Dict* log_dict = update->EnsureDict(histogram_name);
-  log_dict->Set(kLogValueKey, base::NumberToString(value));
-  log_dict->Set(kLogSentKey, entry.sent);
+  pending_value_updates_.insert(histogram_name);
+  SchedulePersistValues();
 }
 
 void MetricLogStore::RemoveValueIfExists(const std::string& histogram_name) {
   log_.erase(histogram_name);
   unsent_entries_.erase(histogram_name);
 
-  // Update the persistent value.
-  ScopedDictPrefUpdate(local_state_, GetPrefName())->Remove(histogram_name);
+  pending_value_updates_.insert(histogram_name);
+  SchedulePersistValues();
 
   if (has_staged_log() && staged_entry_key_ == histogram_name) {
     staged_entry_key_.clear();
@@ -138,6 +170,7 @@ void MetricLogStore::RemoveValueIfExists(const std::string& histogram_name) {
 void MetricLogStore::ResetUploadStamps() {
   // Clear log entries flags.
   ScopedDictPrefUpdate update(local_state_, GetPrefName());
+  WritePendingValues(&update);
   for (auto it = log_.begin(); it != log_.end();) {
     if (it->second.sent) {
       DCHECK(!it->second.sent_timestamp.is_null());
@@ -246,6 +279,7 @@ void MetricLogStore::DiscardStagedLog() {
 
   // Update the persistent value.
   ScopedDictPrefUpdate update(local_state_, GetPrefName());
+  WritePendingValues(&update);
   base::Value::Dict* log_dict = update->EnsureDict(log_iter->first);
   log_dict->Set(kLogSentKey, log_iter->second.sent);
   log_dict->Set(kLogTimestampKey, log_iter->second.sent_timestamp.ToDoubleT());
@@ -12,16 +12,20 @@
 #include "base/containers/flat_set.h"
 #include "base/strings/string_piece.h"
 #include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "brave/components/p3a/metric_log_type.h"
 #include "components/metrics/log_store.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 
 class PrefService;
 class PrefRegistrySimple;
+class ScopedDictPrefUpdate;
 
 namespace p3a {
 
 // Stores all given values in memory and persists in prefs on the fly.
+// Value updates are batched into a single deferred pref update, while upload
+// stamps are persisted right away (together with any pending values).
 // All logs (not only unsent are persistent), and all logs could be loaded
 // using |LoadPersistedUnsentLogs()|. We should fix this at some point since
 // for now persisted entries never expire.
@@ -97,6 +101,11 @@ class MetricLogStore : public metrics::LogStore {
 
   const char* GetPrefName() const;
 
+  void SchedulePersistValues();
+  void PersistPendingValues();
+  // Writes values changed since the last write to |update|.
+  void WritePendingValues(ScopedDictPrefUpdate* update);
+
   Delegate* const delegate_ = nullptr;  // Weak.
   PrefService* const local_state_ = nullptr;
 
@@ -106,6 +115,11 @@ class MetricLogStore : public metrics::LogStore {
   base::flat_map<std::string, LogEntry> log_;
   base::flat_set<std::string> unsent_entries_;
 
+  // Names of entries whose value was updated or removed but not persisted
+  // yet.
+  base::flat_set<std::string> pending_value_updates_;
+  base::OneShotTimer persist_values_timer_;
+
   std::string staged_entry_key_;
   std::string staged_log_;
 
@@ -9,6 +9,7 @@
 #include <set>
 
 #include "base/strings/string_number_conversions.h"
+#include "base/test/task_environment.h"
 #include "brave/components/p3a/metric_log_type.h"
 #include "brave/components/p3a/metric_names.h"
 #include "components/prefs/testing_pref_service.h"
@@ -50,6 +51,10 @@ class P3AMetricLogStoreTest : public testing::Test,
                                                  MetricLogType::kTypical);
   }
 
+  const base::Value::Dict& GetLogs() {
+    return local_state.GetDict("p3a.logs");
+  }
+
   void UpdateSomeValues(size_t message_count) {
     auto* histogram_it = p3a::kCollectedTypicalHistograms.begin();
     for (size_t i = 1; i <= message_count &&
@@ -81,8 +86,10 @@ class P3AMetricLogStoreTest : public testing::Test,
     ASSERT_FALSE(log_store->has_staged_log());
   }
 
-  std::unique_ptr<MetricLogStore> log_store;
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
   TestingPrefServiceSimple local_state;
+  std::unique_ptr<MetricLogStore> log_store;
 };
 
 TEST_F(P3AMetricLogStoreTest, GetAllLogs) {
@@ -116,4 +123,41 @@ TEST_F(P3AMetricLogStoreTest, ShouldNotLoadUnknownMetric) {
   ASSERT_FALSE(log_store->has_unsent_logs());
 }
 
+TEST_F(P3AMetricLogStoreTest, BatchesValueUpdates) {
+  const std::string histogram_name(*p3a::kCollectedTypicalHistograms.begin());
+
+  log_store->UpdateValue(histogram_name, 1);
+  log_store->UpdateValue(histogram_name, 2);
+  EXPECT_TRUE(GetLogs().empty());
+
+  task_environment_.FastForwardBy(base::Seconds(10));
+  const base::Value::Dict* log_dict = GetLogs().FindDict(histogram_name);
+  ASSERT_TRUE(log_dict);
+  EXPECT_EQ(*log_dict->FindString("value"), "2");
+  EXPECT_FALSE(*log_dict->FindBool("sent"));
+
+  log_store->RemoveValueIfExists(histogram_name);
+  EXPECT_TRUE(GetLogs().Find(histogram_name));
+  task_environment_.FastForwardBy(base::Seconds(10));
+  EXPECT_FALSE(GetLogs().Find(histogram_name));
+}
+
+TEST_F(P3AMetricLogStoreTest, PersistsUploadStampsImmediately) {
+  const std::string histogram_name(*p3a::kCollectedTypicalHistograms.begin());
+
+  log_store->UpdateValue(histogram_name, 3);
+  log_store->StageNextLog();
+  log_store->DiscardStagedLog();
+
+  // The pending value is written together with the upload stamp.
+  const base::Value::Dict* log_dict = GetLogs().FindDict(histogram_name);
+  ASSERT_TRUE(log_dict);
+  EXPECT_EQ(*log_dict->FindString("value"), "3");
+  EXPECT_TRUE(*log_dict->FindBool("sent"));
+  EXPECT_TRUE(log_dict->FindDouble("timestamp"));
+
+  log_store->ResetUploadStamps();
+  EXPECT_FALSE(*GetLogs().FindDict(histogram_name)->FindBool("sent"));
+}
+
 }  // namespace p3a
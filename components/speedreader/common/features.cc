@@ -22,4 +22,7 @@ BASE_FEATURE(kSpeedreaderPanelV2,
 const base::FeatureParam<int> kSpeedreaderMinOutLengthParam{
     &kSpeedreaderFeature, "min_out_length", 1000};
 
+const base::FeatureParam<bool> kSpeedreaderStreamingDistillationParam{
+    &kSpeedreaderFeature, "streaming_distillation", false};
+
 }  // namespace speedreader
@@ -12,6 +12,7 @@
 namespace speedreader {
 BASE_DECLARE_FEATURE(kSpeedreaderFeature);
 extern const base::FeatureParam<int> kSpeedreaderMinOutLengthParam;
+extern const base::FeatureParam<bool> kSpeedreaderStreamingDistillationParam;
 BASE_DECLARE_FEATURE(kSpeedreaderPanelV2);
 }  // namespace speedreader
 
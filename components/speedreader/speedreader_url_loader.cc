@@ -108,10 +108,12 @@ void SpeedReaderURLLoader::OnBodyReadable(MojoResult) {
     return;
   }
 
-  // TODO(iefremov): We actually can partially |pumpContent| to speedreader,
-  // but skipping it for now to simplify things. Pumping is not free in terms
-  // of CPU ticks, so we will have to keep alive speedreader instance on another
-  // thread.
+  if (!streaming_distiller_ && IsStreamingDistillationEnabled() &&
+      rewriter_service_ && speedreader_service_) {
+    streaming_distiller_ = std::make_unique<StreamingDistiller>(
+        response_url_, speedreader_service_, rewriter_service_);
+  }
+  StreamBufferedBody();
 
   body_consumer_watcher_.ArmOrNotify();
 }
@@ -136,34 +138,47 @@ void SpeedReaderURLLoader::CompleteLoading(std::string body) {
   bytes_remaining_in_buffer_ = body.size();
 
   if (bytes_remaining_in_buffer_ > 0) {
-    speedreader::DistillPage(
-        response_url_, std::move(body), speedreader_service_, rewriter_service_,
-        base::BindOnce(
-            [](base::WeakPtr<SpeedReaderURLLoader> self, const GURL& url,
-               const std::string& stylesheet,
-               speedreader::DistillationResult result,
-               std::string original_data, std::string transformed) {
-              if (self) {
-                self->distillation_result_ = result;
-
-                if (result == speedreader::DistillationResult::kSuccess) {
-                  MaybeSaveDistilledDataForDebug(url, original_data, stylesheet,
-                                                 transformed);
-                  self->BodySnifferURLLoader::CompleteLoading(
-                      stylesheet + std::move(transformed));
-                } else {
-                  self->BodySnifferURLLoader::CompleteLoading(
-                      std::move(original_data));
-                }
-              }
-            },
-            weak_factory_.GetWeakPtr(), response_url_,
-            rewriter_service_->GetContentStylesheet()));
+    auto callback = base::BindOnce(
+        &SpeedReaderURLLoader::OnDistilled, weak_factory_.GetWeakPtr(),
+        rewriter_service_->GetContentStylesheet());
+    if (streaming_distiller_) {
+      // The whole body has already been written to the rewriter.
+      DCHECK_EQ(streamed_bytes_, body.size());
+      streaming_distiller_->Finish(std::move(body), std::move(callback));
+      return;
+    }
+    speedreader::DistillPage(response_url_, std::move(body),
+                             speedreader_service_, rewriter_service_,
+                             std::move(callback));
     return;
   }
   BodySnifferURLLoader::CompleteLoading(std::move(body));
 }
 
+void SpeedReaderURLLoader::StreamBufferedBody() {
+  if (!streaming_distiller_ || streamed_bytes_ >= buffered_body_.size()) {
+    return;
+  }
+  streaming_distiller_->Write(buffered_body_.substr(streamed_bytes_));
+  streamed_bytes_ = buffered_body_.size();
+}
+
+void SpeedReaderURLLoader::OnDistilled(const std::string& stylesheet,
+                                       DistillationResult result,
+                                       std::string original_data,
+                                       std::string transformed) {
+  streaming_distiller_.reset();
+  distillation_result_ = result;
+
+  if (result == DistillationResult::kSuccess) {
+    MaybeSaveDistilledDataForDebug(response_url_, original_data, stylesheet,
+                                   transformed);
+    BodySnifferURLLoader::CompleteLoading(stylesheet + std::move(transformed));
+  } else {
+    BodySnifferURLLoader::CompleteLoading(std::move(original_data));
+  }
+}
+
 void SpeedReaderURLLoader::OnCompleteSending() {
   // TODO(keur, iefremov): This API could probably be improved with an enum
   // indicating distill success, distill fail, load from cache.
@@ -6,6 +6,7 @@
 #ifndef BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_URL_LOADER_H_
 #define BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_URL_LOADER_H_
 
+#include <memory>
 #include <string>
 #include <tuple>
 
@@ -31,6 +32,7 @@ class SpeedreaderRewriterService;
 class SpeedreaderService;
 class SpeedReaderThrottle;
 class SpeedreaderThrottleDelegate;
+class StreamingDistiller;
 
 // Loads the whole response body and tries to Speedreader-distill it.
 // Cargoculted from |`SniffingURLLoader|.
@@ -44,6 +46,9 @@ class SpeedreaderThrottleDelegate;
 //               state is changed to kLoading. Otherwise the state goes to
 //               kCompleted.
 // kLoading: Receives the body from the source loader and distills the page.
+//            When streaming distillation is enabled, each received chunk is
+//            also written to the rewriter right away, so only the end of the
+//            distillation is left when the body is complete.
 //            The received body is kept in this loader until distilling
 //            is finished. When all body has been received and distilling is
 //            done, this loader will dispatch queued messages like
@@ -87,6 +92,15 @@ class SpeedReaderURLLoader : public body_sniffer::BodySnifferURLLoader {
 
   void CompleteLoading(std::string body) override;
   void OnCompleteSending() override;
+
+  // Writes the part of |buffered_body_| that has not been streamed yet to
+  // |streaming_distiller_|.
+  void StreamBufferedBody();
+  void OnDistilled(const std::string& stylesheet,
+                   DistillationResult result,
+                   std::string original_data,
+                   std::string transformed);
+
   base::WeakPtr<SpeedreaderThrottleDelegate> delegate_;
 
   GURL response_url_;
@@ -97,6 +111,9 @@ class SpeedReaderURLLoader : public body_sniffer::BodySnifferURLLoader {
 
   DistillationResult distillation_result_;
 
+  std::unique_ptr<StreamingDistiller> streaming_distiller_;
+  size_t streamed_bytes_ = 0;
+
   base::WeakPtrFactory<SpeedReaderURLLoader> weak_factory_{this};
 };
 
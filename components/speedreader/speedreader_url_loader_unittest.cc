@@ -0,0 +1,307 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/speedreader/speedreader_url_loader.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/path_service.h"
+#include "base/strings/string_piece.h"
+#include "base/task/single_thread_task_runner.h"
+#include "base/test/metrics/histogram_tester.h"
+#include "base/test/scoped_feature_list.h"
+#include "base/test/task_environment.h"
+#include "base/threading/thread_restrictions.h"
+#include "brave/components/constants/brave_paths.h"
+#include "brave/components/speedreader/common/features.h"
+#include "brave/components/speedreader/speedreader_rewriter_service.h"
+#include "brave/components/speedreader/speedreader_service.h"
+#include "brave/components/speedreader/speedreader_throttle.h"
+#include "brave/components/speedreader/speedreader_throttle_delegate.h"
+#include "brave/components/speedreader/speedreader_util.h"
+#include "components/prefs/testing_pref_service.h"
+#include "mojo/public/cpp/bindings/receiver.h"
+#include "mojo/public/cpp/bindings/remote.h"
+#include "mojo/public/cpp/system/data_pipe.h"
+#include "net/base/net_errors.h"
+#include "net/http/http_response_headers.h"
+#include "net/http/http_util.h"
+#include "services/network/public/cpp/url_loader_completion_status.h"
+#include "services/network/public/mojom/url_response_head.mojom.h"
+#include "services/network/test/test_url_loader_client.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/public/common/loader/url_loader_throttle.h"
+#include "url/gurl.h"
+
+namespace speedreader {
+
+namespace {
+
+// Small enough for the page to reach the loader in several chunks.
+constexpr uint32_t kSourcePipeCapacity = 1024;
+
+class TestSpeedreaderThrottleDelegate
+    : public SpeedreaderThrottleDelegate,
+      public base::SupportsWeakPtr<TestSpeedreaderThrottleDelegate> {
+ public:
+  ~TestSpeedreaderThrottleDelegate() override = default;
+  bool IsPageDistillationAllowed() override { return true; }
+  bool IsPageContentPresent() override { return false; }
+  std::string TakePageContent() override { return {}; }
+  void OnDistillComplete(DistillationResult result) override {
+    result_ = result;
+  }
+
+  DistillationResult result() const { return result_; }
+
+ private:
+  DistillationResult result_ = DistillationResult::kNone;
+};
+
+// Stands in for the ThrottlingURLLoader: feeds the page to the intercepting
+// loader and hands its output to |destination_client_| on Resume().
+class TestURLLoaderThrottleDelegate
+    : public blink::URLLoaderThrottle::Delegate {
+ public:
+  void CancelWithError(int error_code,
+                       base::StringPiece custom_reason) override {
+    ADD_FAILURE() << "Unexpected cancel: " << error_code;
+  }
+
+  void Resume() override {
+    ASSERT_TRUE(destination_body_);
+    destination_client_.OnReceiveResponse(
+        network::mojom::URLResponseHead::New(), std::move(destination_body_),
+        absl::nullopt);
+  }
+
+  void InterceptResponse(
+      mojo::PendingRemote<network::mojom::URLLoader> new_loader,
+      mojo::PendingReceiver<network::mojom::URLLoaderClient>
+          new_client_receiver,
+      mojo::PendingRemote<network::mojom::URLLoader>* original_loader,
+      mojo::PendingReceiver<network::mojom::URLLoaderClient>*
+          original_client_receiver,
+      mojo::ScopedDataPipeConsumerHandle* body) override {
+    intercepting_loader_.Bind(std::move(new_loader));
+    new_client_receiver_ = std::move(new_client_receiver);
+    source_loader_receiver_ = original_loader->InitWithNewPipeAndPassReceiver();
+    *original_client_receiver = source_client_.BindNewPipeAndPassReceiver();
+
+    // |body| is what the intercepting loader produces. Replace it with the
+    // body of the original response.
+    destination_body_ = std::move(*body);
+    const MojoCreateDataPipeOptions options = {
+        sizeof(MojoCreateDataPipeOptions), MOJO_CREATE_DATA_PIPE_FLAG_NONE, 1,
+        kSourcePipeCapacity};
+    mojo::ScopedDataPipeConsumerHandle source_body;
+    ASSERT_EQ(MOJO_RESULT_OK,
+              mojo::CreateDataPipe(&options, source_body_, source_body));
+    *body = std::move(source_body);
+  }
+
+  mojo::ScopedDataPipeProducerHandle& source_body() { return source_body_; }
+  mojo::Remote<network::mojom::URLLoaderClient>& source_client() {
+    return source_client_;
+  }
+  network::TestURLLoaderClient& destination_client() {
+    return destination_client_;
+  }
+
+ private:
+  mojo::Remote<network::mojom::URLLoader> intercepting_loader_;
+  mojo::PendingReceiver<network::mojom::URLLoaderClient> new_client_receiver_;
+  mojo::PendingReceiver<network::mojom::URLLoader> source_loader_receiver_;
+  mojo::Remote<network::mojom::URLLoaderClient> source_client_;
+  mojo::ScopedDataPipeProducerHandle source_body_;
+  mojo::ScopedDataPipeConsumerHandle destination_body_;
+  network::TestURLLoaderClient destination_client_;
+};
+
+}  // namespace
+
+class SpeedReaderURLLoaderTest : public testing::Test {
+ public:
+  SpeedReaderURLLoaderTest() = default;
+  ~SpeedReaderURLLoaderTest() override = default;
+  SpeedReaderURLLoaderTest(const SpeedReaderURLLoaderTest&) = delete;
+  SpeedReaderURLLoaderTest& operator=(const SpeedReaderURLLoaderTest&) =
+      delete;
+
+  void SetUp() override {
+    SpeedreaderService::RegisterProfilePrefs(prefs_.registry());
+    speedreader_service_ = std::make_unique<SpeedreaderService>(&prefs_);
+    rewriter_service_ = std::make_unique<SpeedreaderRewriterService>();
+  }
+
+  void EnableStreaming(bool enabled) {
+    feature_list_.InitAndEnableFeatureWithParameters(
+        kSpeedreaderFeature,
+        {{"min_out_length", "100"},
+         {"streaming_distillation", enabled ? "true" : "false"}});
+  }
+
+  std::string GetTestPage(const std::string& file_name) {
+    base::ScopedAllowBlockingForTesting allow_blocking;
+    base::FilePath test_data_dir;
+    base::PathService::Get(brave::DIR_TEST_DATA, &test_data_dir);
+    std::string page;
+    EXPECT_TRUE(base::ReadFileToString(test_data_dir.AppendASCII("speedreader")
+                                           .AppendASCII("rewriter")
+                                           .AppendASCII(file_name),
+                                       &page));
+    return page;
+  }
+
+  // Loads |page| through a SpeedReaderURLLoader and returns the body that
+  // reaches the destination client.
+  std::string Load(const std::string& page) {
+    const GURL url("https://test.com");
+    auto throttle = SpeedReaderThrottle::MaybeCreateThrottleFor(
+        rewriter_service_.get(), speedreader_service_.get(), nullptr,
+        speedreader_delegate_.AsWeakPtr(), url, false,
+        base::SingleThreadTaskRunner::GetCurrentDefault());
+    TestURLLoaderThrottleDelegate throttle_delegate;
+    throttle->set_delegate(&throttle_delegate);
+
+    auto response_head = network::mojom::URLResponseHead::New();
+    response_head->headers = base::MakeRefCounted<net::HttpResponseHeaders>(
+        net::HttpUtil::AssembleRawHeaders(
+            "HTTP/1.1 200 OK\nContent-Type: text/html\n\n"));
+    bool defer = false;
+    throttle->WillProcessResponse(url, response_head.get(), &defer);
+    EXPECT_TRUE(defer);
+
+    WriteSourceBody(throttle_delegate.source_body(), page);
+    throttle_delegate.source_client()->OnComplete(
+        network::URLLoaderCompletionStatus(net::OK));
+    task_environment_.RunUntilIdle();
+
+    auto& destination_client = throttle_delegate.destination_client();
+    EXPECT_TRUE(destination_client.has_received_response());
+    return ReadDestinationBody(destination_client.response_body_release());
+  }
+
+  DistillationResult result() const { return speedreader_delegate_.result(); }
+
+  SpeedreaderRewriterService* rewriter_service() {
+    return rewriter_service_.get();
+  }
+
+ private:
+  void WriteSourceBody(mojo::ScopedDataPipeProducerHandle& producer,
+                       base::StringPiece body) {
+    while (!body.empty()) {
+      uint32_t size = body.size();
+      const MojoResult result =
+          producer->WriteData(body.data(), &size, MOJO_WRITE_DATA_FLAG_NONE);
+      if (result == MOJO_RESULT_SHOULD_WAIT) {
+        task_environment_.RunUntilIdle();
+        continue;
+      }
+      ASSERT_EQ(MOJO_RESULT_OK, result);
+      body.remove_prefix(size);
+      // Let the loader read and stream each chunk.
+      task_environment_.RunUntilIdle();
+    }
+    producer.reset();
+  }
+
+  std::string ReadDestinationBody(mojo::ScopedDataPipeConsumerHandle body) {
+    std::string output;
+    while (true) {
+      char buffer[kSourcePipeCapacity];
+      uint32_t size = sizeof(buffer);
+      const MojoResult result =
+          body->ReadData(buffer, &size, MOJO_READ_DATA_FLAG_NONE);
+      if (result == MOJO_RESULT_SHOULD_WAIT) {
+        task_environment_.RunUntilIdle();
+        continue;
+      }
+      if (result != MOJO_RESULT_OK) {
+        EXPECT_EQ(MOJO_RESULT_FAILED_PRECONDITION, result);
+        return output;
+      }
+      output.append(buffer, size);
+    }
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  base::test::ScopedFeatureList feature_list_;
+  TestingPrefServiceSimple prefs_;
+  std::unique_ptr<SpeedreaderService> speedreader_service_;
+  std::unique_ptr<SpeedreaderRewriterService> rewriter_service_;
+  TestSpeedreaderThrottleDelegate speedreader_delegate_;
+};
+
+TEST_F(SpeedReaderURLLoaderTest, StreamingDistillation) {
+  EnableStreaming(true);
+  base::HistogramTester histogram_tester;
+
+  const std::string page = GetTestPage("no_span_root.html");
+  ASSERT_GT(page.size(), kSourcePipeCapacity);
+  const std::string output = Load(page);
+
+  EXPECT_EQ(DistillationResult::kSuccess, result());
+  EXPECT_EQ(0u, output.find(rewriter_service()->GetContentStylesheet()));
+  EXPECT_NE(page, output);
+  histogram_tester.ExpectTotalCount("Brave.Speedreader.Distill.Streaming", 1);
+  histogram_tester.ExpectTotalCount("Brave.Speedreader.Distill", 0);
+}
+
+TEST_F(SpeedReaderURLLoaderTest, WholeBodyDistillation) {
+  EnableStreaming(false);
+  base::HistogramTester histogram_tester;
+
+  const std::string page = GetTestPage("no_span_root.html");
+  const std::string output = Load(page);
+
+  EXPECT_EQ(DistillationResult::kSuccess, result());
+  EXPECT_EQ(0u, output.find(rewriter_service()->GetContentStylesheet()));
+  histogram_tester.ExpectTotalCount("Brave.Speedreader.Distill", 1);
+  histogram_tester.ExpectTotalCount("Brave.Speedreader.Distill.Streaming", 0);
+}
+
+TEST_F(SpeedReaderURLLoaderTest, StreamingMatchesWholeBody) {
+  const std::string page = GetTestPage("no_span_root.html");
+
+  std::string streamed;
+  {
+    base::test::ScopedFeatureList feature_list;
+    feature_list.InitAndEnableFeatureWithParameters(
+        kSpeedreaderFeature,
+        {{"min_out_length", "100"}, {"streaming_distillation", "true"}});
+    streamed = Load(page);
+  }
+  std::string whole_body;
+  {
+    base::test::ScopedFeatureList feature_list;
+    feature_list.InitAndEnableFeatureWithParameters(
+        kSpeedreaderFeature,
+        {{"min_out_length", "100"}, {"streaming_distillation", "false"}});
+    whole_body = Load(page);
+  }
+  EXPECT_EQ(whole_body, streamed);
+}
+
+TEST_F(SpeedReaderURLLoaderTest, StreamingFallsBackToOriginalPage) {
+  EnableStreaming(true);
+
+  // Distills to nothing, so the loader has to send the original page.
+  const std::string page = GetTestPage("too_small_output.html");
+  ASSERT_GT(page.size(), kSourcePipeCapacity);
+  const std::string output = Load(page);
+
+  EXPECT_EQ(DistillationResult::kFail, result());
+  EXPECT_EQ(page, output);
+}
+
+}  // namespace speedreader
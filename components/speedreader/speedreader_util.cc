@@ -9,10 +9,14 @@
 #include <tuple>
 #include <utility>
 
+#include "base/check.h"
 #include "base/feature_list.h"
+#include "base/functional/bind.h"
 #include "base/metrics/histogram_macros.h"
+#include "base/task/sequenced_task_runner.h"
 #include "base/task/task_traits.h"
 #include "base/task/thread_pool.h"
+#include "base/time/time.h"
 #include "brave/components/speedreader/common/features.h"
 #include "brave/components/speedreader/rust/ffi/speedreader.h"
 #include "brave/components/speedreader/speedreader_rewriter_service.h"
@@ -25,6 +29,46 @@
 
 namespace speedreader {
 
+namespace {
+
+struct Result {
+  DistillationResult result;
+  std::string body;
+  std::string transformed;
+};
+
+std::unique_ptr<Rewriter> MakeRewriter(
+    const GURL& url,
+    SpeedreaderService* speedreader_service,
+    SpeedreaderRewriterService* rewriter_service) {
+  return rewriter_service->MakeRewriter(
+      url, speedreader_service->GetThemeName(),
+      speedreader_service->GetFontFamilyName(),
+      speedreader_service->GetFontSizeName(),
+      speedreader_service->GetContentStyleName());
+}
+
+// Ends the rewriter, which must have been fed with the whole of |data|.
+Result EndDistillation(Rewriter* rewriter, std::string data) {
+  rewriter->End();
+  const std::string& transformed = rewriter->GetOutput();
+
+  // If the distillation failed, the rewriter returns an empty string. Also,
+  // if the output is too small, we assume that the content of the distilled
+  // page does not contain enough text to read.
+  if (transformed.length() < 1024) {
+    return {DistillationResult::kFail, std::move(data), std::string()};
+  }
+  return {DistillationResult::kSuccess, std::move(data), transformed};
+}
+
+void ReturnResult(DistillationResultCallback callback, Result r) {
+  std::move(callback).Run(r.result, std::move(r.body),
+                          std::move(r.transformed));
+}
+
+}  // namespace
+
 bool PageSupportsDistillation(DistillState state) {
   return state == DistillState::kSpeedreaderOnDisabledPage ||
          state == DistillState::kPageProbablyReadable;
@@ -72,17 +116,15 @@ bool IsSpeedreaderPanelV2Enabled() {
   return base::FeatureList::IsEnabled(speedreader::kSpeedreaderPanelV2);
 }
 
+bool IsStreamingDistillationEnabled() {
+  return kSpeedreaderStreamingDistillationParam.Get();
+}
+
 void DistillPage(const GURL& url,
                  std::string body,
                  SpeedreaderService* speedreader_service,
                  SpeedreaderRewriterService* rewriter_service,
                  DistillationResultCallback callback) {
-  struct Result {
-    DistillationResult result;
-    std::string body;
-    std::string transformed;
-  };
-
   auto distill = [](const GURL& url, std::string data,
                     std::unique_ptr<Rewriter> rewriter) -> Result {
     SCOPED_UMA_HISTOGRAM_TIMER("Brave.Speedreader.Distill");
@@ -92,32 +134,86 @@ void DistillPage(const GURL& url,
       return {DistillationResult::kFail, std::move(data), std::string()};
     }
 
-    rewriter->End();
-    const std::string& transformed = rewriter->GetOutput();
-
-    // If the distillation failed, the rewriter returns an empty string. Also,
-    // if the output is too small, we assume that the content of the distilled
-    // page does not contain enough text to read.
-    if (transformed.length() < 1024) {
-      return {DistillationResult::kFail, std::move(data), std::string()};
-    }
-    return {DistillationResult::kSuccess, std::move(data), transformed};
+    return EndDistillation(rewriter.get(), std::move(data));
   };
 
-  auto return_result = [](DistillationResultCallback callback, Result r) {
-    std::move(callback).Run(r.result, r.body, r.transformed);
-  };
-
-  auto rewriter = rewriter_service->MakeRewriter(
-      url, speedreader_service->GetThemeName(),
-      speedreader_service->GetFontFamilyName(),
-      speedreader_service->GetFontSizeName(),
-      speedreader_service->GetContentStyleName());
+  auto rewriter = MakeRewriter(url, speedreader_service, rewriter_service);
 
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::TaskPriority::USER_BLOCKING, base::MayBlock()},
       base::BindOnce(distill, url, std::move(body), std::move(rewriter)),
-      base::BindOnce(return_result, std::move(callback)));
+      base::BindOnce(&ReturnResult, std::move(callback)));
+}
+
+struct StreamingDistiller::State {
+  std::unique_ptr<Rewriter> rewriter;
+  bool failed = false;
+  // Time spent in the rewriter so far, reported when distillation ends.
+  base::TimeDelta rewriter_time;
+};
+
+StreamingDistiller::StreamingDistiller(
+    const GURL& url,
+    SpeedreaderService* speedreader_service,
+    SpeedreaderRewriterService* rewriter_service)
+    : task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
+          {base::TaskPriority::USER_BLOCKING, base::MayBlock()})),
+      state_(new State, base::OnTaskRunnerDeleter(task_runner_)) {
+  state_->rewriter = MakeRewriter(url, speedreader_service, rewriter_service);
+}
+
+StreamingDistiller::~StreamingDistiller() = default;
+
+void StreamingDistiller::Write(std::string chunk) {
+  DCHECK_CALLING_ON_SEQUENCE(sequence_checker_);
+  DCHECK(!finished_);
+  if (chunk.empty()) {
+    return;
+  }
+
+  auto write = [](State* state, std::string chunk) {
+    if (!state->failed) {
+      const base::TimeTicks start_time = base::TimeTicks::Now();
+      state->failed =
+          state->rewriter->Write(chunk.c_str(), chunk.length()) != 0;
+      state->rewriter_time += base::TimeTicks::Now() - start_time;
+    }
+  };
+
+  // |state_| is deleted on |task_runner_|, after all the tasks posted here.
+  task_runner_->PostTask(FROM_HERE,
+                         base::BindOnce(write, base::Unretained(state_.get()),
+                                        std::move(chunk)));
+}
+
+void StreamingDistiller::Finish(std::string body,
+                                DistillationResultCallback callback) {
+  DCHECK_CALLING_ON_SEQUENCE(sequence_checker_);
+  DCHECK(!finished_);
+  finished_ = true;
+
+  auto finish = [](State* state, std::string data) -> Result {
+    // Nothing has been sent to the client yet, so the original page can
+    // still be used if the rewriter failed on any chunk.
+    if (state->failed) {
+      UMA_HISTOGRAM_TIMES("Brave.Speedreader.Distill.Streaming",
+                          state->rewriter_time);
+      return {DistillationResult::kFail, std::move(data), std::string()};
+    }
+    const base::TimeTicks start_time = base::TimeTicks::Now();
+    Result result = EndDistillation(state->rewriter.get(), std::move(data));
+    // Unlike Brave.Speedreader.Distill, this includes the time spent on
+    // every chunk while the page was loading, not only the end.
+    UMA_HISTOGRAM_TIMES(
+        "Brave.Speedreader.Distill.Streaming",
+        state->rewriter_time + (base::TimeTicks::Now() - start_time));
+    return result;
+  };
+
+  task_runner_->PostTaskAndReplyWithResult(
+      FROM_HERE,
+      base::BindOnce(finish, base::Unretained(state_.get()), std::move(body)),
+      base::BindOnce(&ReturnResult, std::move(callback)));
 }
 
 }  // namespace speedreader
@@ -6,9 +6,13 @@
 #ifndef BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_UTIL_H_
 #define BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_UTIL_H_
 
+#include <memory>
 #include <string>
 
 #include "base/functional/callback_forward.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/sequence_checker.h"
+#include "base/task/sequenced_task_runner.h"
 
 class GURL;
 class HostContentSettingsMap;
@@ -85,6 +89,9 @@ bool IsEnabledForSite(HostContentSettingsMap* map, const GURL& url);
 
 bool IsSpeedreaderPanelV2Enabled();
 
+// Whether pages should be fed to the rewriter while they are being loaded.
+bool IsStreamingDistillationEnabled();
+
 using DistillationResultCallback =
     base::OnceCallback<void(DistillationResult result,
                             std::string original_data,
@@ -95,6 +102,40 @@ void DistillPage(const GURL& url,
                  SpeedreaderRewriterService* rewriter_service,
                  DistillationResultCallback callback);
 
+// Distills a page while it is being loaded: chunks are written to the rewriter
+// on a background sequence as they arrive, so only the end of the distillation
+// is left to do once the whole body has been received. The rewriter only
+// produces output when it is ended, so if it fails on any chunk the original
+// body is returned instead.
+class StreamingDistiller {
+ public:
+  StreamingDistiller(const GURL& url,
+                     SpeedreaderService* speedreader_service,
+                     SpeedreaderRewriterService* rewriter_service);
+  StreamingDistiller(const StreamingDistiller&) = delete;
+  StreamingDistiller& operator=(const StreamingDistiller&) = delete;
+  ~StreamingDistiller();
+
+  // Feeds the next chunk of the page to the rewriter.
+  void Write(std::string chunk);
+
+  // Ends distillation. |body| must be the whole page, all of which has been
+  // passed to Write(). It is handed back to |callback| as the original data.
+  // Records the rewriter time across all chunks as
+  // "Brave.Speedreader.Distill.Streaming".
+  void Finish(std::string body, DistillationResultCallback callback);
+
+ private:
+  struct State;
+
+  scoped_refptr<base::SequencedTaskRunner> task_runner_;
+  // Only accessed on |task_runner_|.
+  std::unique_ptr<State, base::OnTaskRunnerDeleter> state_;
+  bool finished_ = false;
+
+  SEQUENCE_CHECKER(sequence_checker_);
+};
+
 }  // namespace speedreader
 
 #endif  // BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_UTIL_H_
@@ -6,10 +6,9 @@
 #include "brave/components/time_period_storage/time_period_storage.h"
 
 #include <algorithm>
-#include <numeric>
 #include <utility>
 
-#include "base/ranges/algorithm.h"
+#include "base/location.h"
 #include "base/time/clock.h"
 #include "base/time/default_clock.h"
 #include "base/values.h"
@@ -21,8 +20,10 @@ TimePeriodStorage::TimePeriodStorage(PrefService* prefs,
     : clock_(std::make_unique<base::DefaultClock>()),
       prefs_(prefs),
       pref_name_(pref_name),
-      period_days_(period_days) {
+      period_days_(period_days),
+      daily_values_(period_days) {
   DCHECK(pref_name);
+  DCHECK_GT(period_days, 0u);
   if (prefs) {
     Load();
   }
@@ -35,73 +36,79 @@ TimePeriodStorage::TimePeriodStorage(PrefService* prefs,
     : clock_(std::move(clock)),
       prefs_(prefs),
       pref_name_(pref_name),
-      period_days_(period_days) {
+      period_days_(period_days),
+      daily_values_(period_days) {
   DCHECK(prefs);
   DCHECK(pref_name);
+  DCHECK_GT(period_days, 0u);
   Load();
 }
 
-TimePeriodStorage::~TimePeriodStorage() = default;
+TimePeriodStorage::~TimePeriodStorage() {
+  FlushPendingWrites();
+}
 
 void TimePeriodStorage::AddDelta(uint64_t delta) {
-  FilterToPeriod();
-  daily_values_.front().value += delta;
-  Save();
+  const bool day_changed = FilterToPeriod();
+  DailyValueAt(0).value += delta;
+  ScheduleSave(day_changed);
 }
 
 void TimePeriodStorage::SubDelta(uint64_t delta) {
-  FilterToPeriod();
-  for (DailyValue& daily_value : daily_values_) {
-    if (delta == 0) {
-      break;
-    }
+  const bool day_changed = FilterToPeriod();
+  for (size_t i = 0; i < daily_values_count_ && delta > 0; ++i) {
+    DailyValue& daily_value = DailyValueAt(i);
     uint64_t day_delta = std::min(daily_value.value, delta);
     daily_value.value -= day_delta;
     delta -= day_delta;
   }
-  Save();
+  ScheduleSave(day_changed);
 }
 
 void TimePeriodStorage::ReplaceTodaysValueIfGreater(uint64_t value) {
-  FilterToPeriod();
-  DailyValue& today = daily_values_.front();
+  const bool day_changed = FilterToPeriod();
+  DailyValue& today = DailyValueAt(0);
   if (today.value < value) {
     today.value = value;
   }
-  Save();
+  ScheduleSave(day_changed);
 }
 
 void TimePeriodStorage::ReplaceIfGreaterForDate(const base::Time& date,
                                                 uint64_t value) {
-  FilterToPeriod();
+  const bool day_changed = FilterToPeriod();
   base::Time date_mn = date.LocalMidnight();
-  std::list<DailyValue>::iterator day_insert_it = base::ranges::find_if(
-      daily_values_,
-      [date_mn](const DailyValue& val) { return val.day <= date_mn; });
-  if (day_insert_it != daily_values_.end() && day_insert_it->day == date_mn) {
+  size_t day_insert_index = 0;
+  while (day_insert_index < daily_values_count_ &&
+         DailyValueAt(day_insert_index).day > date_mn) {
+    ++day_insert_index;
+  }
+  if (day_insert_index < daily_values_count_ &&
+      DailyValueAt(day_insert_index).day == date_mn) {
     // update daily value if it exists for date
-    if (value > day_insert_it->value) {
-      day_insert_it->value = value;
+    DailyValue& daily_value = DailyValueAt(day_insert_index);
+    if (value > daily_value.value) {
+      daily_value.value = value;
     }
   } else {
-    daily_values_.insert(day_insert_it, {date_mn, value});
+    InsertDailyValue(day_insert_index, {date_mn, value});
   }
-  Save();
+  ScheduleSave(day_changed);
 }
 
 uint64_t TimePeriodStorage::GetPeriodSumInTimeRange(
     const base::Time& start_time,
     const base::Time& end_time) const {
   // We only record values between the specified time range (inclusive).
-  return std::accumulate(daily_values_.begin(), daily_values_.end(), 0ull,
-                         [start_time, end_time](uint64_t acc, const auto& u2) {
-                           uint64_t add = 0;
-                           // Check only last continious days.
-                           if (u2.day >= start_time && u2.day <= end_time) {
-                             add = u2.value;
-                           }
-                           return acc + add;
-                         });
+  uint64_t sum = 0;
+  for (size_t i = 0; i < daily_values_count_; ++i) {
+    const DailyValue& daily_value = DailyValueAt(i);
+    // Check only last continious days.
+    if (daily_value.day >= start_time && daily_value.day <= end_time) {
+      sum += daily_value.value;
+    }
+  }
+  return sum;
 }
 
 uint64_t TimePeriodStorage::GetPeriodSum() const {
@@ -114,51 +121,85 @@ uint64_t TimePeriodStorage::GetPeriodSum() const {
 uint64_t TimePeriodStorage::GetHighestValueInPeriod() const {
   // We record only value for last N days.
   const base::Time n_days_ago = clock_->Now() - base::Days(period_days_);
-  std::list<DailyValue> in_period_daily_values(daily_values_.size());
-  auto copied_it =
-      std::copy_if(daily_values_.begin(), daily_values_.end(),
-                   in_period_daily_values.begin(),
-                   [n_days_ago](auto i) { return i.day > n_days_ago; });
-  in_period_daily_values.resize(
-      std::distance(in_period_daily_values.begin(), copied_it));
-
-  auto highest_it = std::max_element(in_period_daily_values.begin(),
-                                     in_period_daily_values.end(),
-                                     [](const auto& left, const auto& right) {
-                                       return left.value < right.value;
-                                     });
-  if (highest_it == in_period_daily_values.end()) {
-    return 0;
+  uint64_t highest = 0;
+  for (size_t i = 0; i < daily_values_count_; ++i) {
+    const DailyValue& daily_value = DailyValueAt(i);
+    if (daily_value.day > n_days_ago) {
+      highest = std::max(highest, daily_value.value);
+    }
   }
-  return highest_it->value;
+  return highest;
 }
 
 bool TimePeriodStorage::IsOnePeriodPassed() const {
   // TODO(iefremov): This is not true 100% (if the browser was launched once
   // per the time period just after installation, for example).
-  return daily_values_.size() == period_days_;
+  return daily_values_count_ == period_days_;
+}
+
+void TimePeriodStorage::EnableBufferedWrites(base::TimeDelta flush_delay) {
+  DCHECK(flush_delay.is_positive());
+  flush_delay_ = flush_delay;
+}
+
+void TimePeriodStorage::FlushPendingWrites() {
+  if (!save_timer_.IsRunning()) {
+    return;
+  }
+  save_timer_.Stop();
+  Save();
+}
+
+TimePeriodStorage::DailyValue& TimePeriodStorage::DailyValueAt(size_t index) {
+  DCHECK_LT(index, daily_values_count_);
+  return daily_values_[(daily_values_head_ + index) % period_days_];
+}
+
+const TimePeriodStorage::DailyValue& TimePeriodStorage::DailyValueAt(
+    size_t index) const {
+  DCHECK_LT(index, daily_values_count_);
+  return daily_values_[(daily_values_head_ + index) % period_days_];
+}
+
+void TimePeriodStorage::InsertDailyValue(size_t index,
+                                         const DailyValue& daily_value) {
+  DCHECK_LE(index, daily_values_count_);
+  if (index == period_days_) {
+    // Older than everything we keep.
+    return;
+  }
+  if (index == 0) {
+    daily_values_head_ = (daily_values_head_ + period_days_ - 1) % period_days_;
+    daily_values_count_ = std::min(daily_values_count_ + 1, period_days_);
+    DailyValueAt(0) = daily_value;
+    return;
+  }
+  daily_values_count_ = std::min(daily_values_count_ + 1, period_days_);
+  for (size_t i = daily_values_count_ - 1; i > index; --i) {
+    DailyValueAt(i) = DailyValueAt(i - 1);
+  }
+  DailyValueAt(index) = daily_value;
 }
 
-void TimePeriodStorage::FilterToPeriod() {
+bool TimePeriodStorage::FilterToPeriod() {
   base::Time now_midnight = clock_->Now().LocalMidnight();
   base::Time last_saved_midnight;
 
-  if (!daily_values_.empty()) {
-    last_saved_midnight = daily_values_.front().day;
+  if (daily_values_count_ > 0) {
+    last_saved_midnight = DailyValueAt(0).day;
   }
 
   if (now_midnight - last_saved_midnight > base::TimeDelta()) {
     // Day changed. Since we consider only small incoming intervals, lets just
     // save it with a new timestamp.
-    daily_values_.push_front({now_midnight, 0});
-    if (daily_values_.size() > period_days_) {
-      daily_values_.pop_back();
-    }
+    InsertDailyValue(0, {now_midnight, 0});
+    return true;
   }
+  return false;
 }
 
 void TimePeriodStorage::Load() {
-  DCHECK(daily_values_.empty());
+  DCHECK_EQ(daily_values_count_, 0u);
   const auto& list = prefs_->GetList(pref_name_);
   for (const auto& it : list) {
     DCHECK(it.is_dict());
@@ -168,22 +209,33 @@ void TimePeriodStorage::Load() {
     if (!day || !value) {
       continue;
     }
-    if (daily_values_.size() == period_days_) {
+    if (daily_values_count_ == period_days_) {
       break;
     }
-    daily_values_.push_back(
-        {base::Time::FromDoubleT(*day), static_cast<uint64_t>(*value)});
+    InsertDailyValue(daily_values_count_, {base::Time::FromDoubleT(*day),
+                                           static_cast<uint64_t>(*value)});
+  }
+}
+
+void TimePeriodStorage::ScheduleSave(bool day_changed) {
+  if (flush_delay_.is_zero() || day_changed) {
+    save_timer_.Stop();
+    Save();
+    return;
+  }
+  if (!save_timer_.IsRunning()) {
+    save_timer_.Start(FROM_HERE, flush_delay_, this, &TimePeriodStorage::Save);
   }
 }
 
 void TimePeriodStorage::Save() {
-  DCHECK(!daily_values_.empty());
-  DCHECK_LE(daily_values_.size(), period_days_);
+  DCHECK_GT(daily_values_count_, 0u);
+  DCHECK_LE(daily_values_count_, period_days_);
 
   base::Value::List list;
-  // TODO(iefremov): Optimize if needed.
-  list.clear();
-  for (const auto& u : daily_values_) {
+  list.reserve(daily_values_count_);
+  for (size_t i = 0; i < daily_values_count_; ++i) {
+    const DailyValue& u = DailyValueAt(i);
     base::Value::Dict value;
     value.Set("day", u.day.ToDoubleT());
     value.Set("value", static_cast<double>(u.value));
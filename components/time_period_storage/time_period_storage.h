@@ -6,10 +6,11 @@
 #ifndef BRAVE_COMPONENTS_TIME_PERIOD_STORAGE_TIME_PERIOD_STORAGE_H_
 #define BRAVE_COMPONENTS_TIME_PERIOD_STORAGE_TIME_PERIOD_STORAGE_H_
 
-#include <list>
 #include <memory>
+#include <vector>
 
 #include "base/time/time.h"
+#include "base/timer/timer.h"
 
 namespace base {
 class Clock;
@@ -20,6 +21,8 @@ class PrefService;
 // Mostly used by various P3A recorders - allows to track a sum of some
 // values added from time to time via |AddDelta| over the last predefined time
 // period. Requires |pref_name| to be already registered.
+// By default every update is written to prefs right away; long-lived instances
+// that are updated frequently should call |EnableBufferedWrites|.
 class TimePeriodStorage {
  public:
   TimePeriodStorage(PrefService* prefs,
@@ -46,6 +49,13 @@ class TimePeriodStorage {
   uint64_t GetHighestValueInPeriod() const;
   bool IsOnePeriodPassed() const;
 
+  // Keeps updates in memory and writes them to prefs at most once per
+  // |flush_delay|, on a day change and on destruction. Must be called on a
+  // sequence with a task runner.
+  void EnableBufferedWrites(base::TimeDelta flush_delay);
+  // Writes buffered updates to prefs, if any.
+  void FlushPendingWrites();
+
  protected:
   std::unique_ptr<base::Clock> clock_;
 
@@ -54,15 +64,31 @@ class TimePeriodStorage {
     base::Time day;
     uint64_t value = 0ull;
   };
-  void FilterToPeriod();
+  // Index 0 is the most recent day.
+  DailyValue& DailyValueAt(size_t index);
+  const DailyValue& DailyValueAt(size_t index) const;
+  // Inserts |daily_value| before |index|, dropping the oldest day if the
+  // storage is full.
+  void InsertDailyValue(size_t index, const DailyValue& daily_value);
+
+  // Returns true if a new day was started.
+  bool FilterToPeriod();
   void Load();
+  void ScheduleSave(bool day_changed);
   void Save();
 
   PrefService* prefs_ = nullptr;
   const char* pref_name_ = nullptr;
   size_t period_days_;
 
-  std::list<DailyValue> daily_values_;
+  // Ring buffer of |period_days_| entries, |daily_values_count_| of which
+  // are in use starting at |daily_values_head_|.
+  std::vector<DailyValue> daily_values_;
+  size_t daily_values_head_ = 0;
+  size_t daily_values_count_ = 0;
+
+  base::TimeDelta flush_delay_;
+  base::OneShotTimer save_timer_;
 };
 
 #endif  // BRAVE_COMPONENTS_TIME_PERIOD_STORAGE_TIME_PERIOD_STORAGE_H_
@@ -10,6 +10,7 @@
 
 #include "base/memory/raw_ptr.h"
 #include "base/test/simple_test_clock.h"
+#include "base/test/task_environment.h"
 #include "base/time/time.h"
 #include "components/prefs/pref_registry_simple.h"
 #include "components/prefs/testing_pref_service.h"
@@ -30,7 +31,17 @@ class TimePeriodStorageTest : public ::testing::Test {
         &pref_service_, kPrefName, days, std::unique_ptr<base::Clock>(clock_));
   }
 
+  // Creates another storage reading the same pref.
+  std::unique_ptr<TimePeriodStorage> LoadStorage(size_t days, base::Time now) {
+    auto clock = std::make_unique<base::SimpleTestClock>();
+    clock->SetNow(now);
+    return std::make_unique<TimePeriodStorage>(&pref_service_, kPrefName, days,
+                                               std::move(clock));
+  }
+
  protected:
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
   raw_ptr<base::SimpleTestClock> clock_ = nullptr;
   TestingPrefServiceSimple pref_service_;
   std::unique_ptr<TimePeriodStorage> state_;
@@ -286,3 +297,67 @@ TEST_F(TimePeriodStorageTest, ReplaceIfGreaterForDate) {
   state_->ReplaceIfGreaterForDate(clock_->Now() - base::Days(31), 10);
   EXPECT_EQ(state_->GetPeriodSum(), 11U);
 }
+
+TEST_F(TimePeriodStorageTest, BufferedWrites) {
+  InitStorage(7);
+  state_->EnableBufferedWrites(base::Minutes(1));
+
+  // The first update of a day is written right away.
+  state_->AddDelta(10);
+  EXPECT_EQ(pref_service_.GetList(kPrefName).size(), 1u);
+
+  // Further updates are kept in memory until the flush delay passes.
+  state_->AddDelta(20);
+  state_->ReplaceTodaysValueIfGreater(50);
+  EXPECT_EQ(state_->GetPeriodSum(), 50u);
+  EXPECT_EQ(*pref_service_.GetList(kPrefName)[0].GetDict().FindDouble("value"),
+            10);
+
+  task_environment_.FastForwardBy(base::Minutes(1));
+  EXPECT_EQ(*pref_service_.GetList(kPrefName)[0].GetDict().FindDouble("value"),
+            50);
+
+  // A new day flushes immediately.
+  state_->AddDelta(5);
+  clock_->Advance(base::Days(1));
+  state_->AddDelta(7);
+  EXPECT_EQ(pref_service_.GetList(kPrefName).size(), 2u);
+  EXPECT_EQ(*pref_service_.GetList(kPrefName)[1].GetDict().FindDouble("value"),
+            55);
+
+  // Pending updates are written on destruction.
+  state_->AddDelta(3);
+  const base::Time now = clock_->Now();
+  clock_ = nullptr;
+  state_.reset();
+  EXPECT_EQ(*pref_service_.GetList(kPrefName)[0].GetDict().FindDouble("value"),
+            10);
+
+  EXPECT_EQ(LoadStorage(7, now)->GetPeriodSum(), 65u);
+}
+
+TEST_F(TimePeriodStorageTest, KeepsOnlyPeriodDays) {
+  InitStorage(3);
+  const base::Time first_day = clock_->Now();
+  state_->AddDelta(1);
+  clock_->Advance(base::Days(2));
+  state_->AddDelta(2);
+  clock_->Advance(base::Days(1));
+  state_->AddDelta(3);
+  EXPECT_EQ(pref_service_.GetList(kPrefName).size(), 3u);
+  EXPECT_EQ(state_->GetPeriodSum(), 5u);
+
+  // Filling the skipped day drops the oldest one.
+  state_->ReplaceIfGreaterForDate(first_day + base::Days(1), 10);
+  EXPECT_EQ(pref_service_.GetList(kPrefName).size(), 3u);
+  EXPECT_EQ(state_->GetPeriodSum(), 15u);
+
+  // Days older than everything stored are ignored once full.
+  state_->ReplaceIfGreaterForDate(first_day - base::Days(1), 100);
+  EXPECT_EQ(pref_service_.GetList(kPrefName).size(), 3u);
+  EXPECT_EQ(state_->GetPeriodSum(), 15u);
+
+  auto reloaded = LoadStorage(3, clock_->Now());
+  EXPECT_EQ(reloaded->GetPeriodSum(), 15u);
+  EXPECT_TRUE(reloaded->IsOnePeriodPassed());
+}
@@ -9,6 +9,7 @@
 
 #include "base/functional/callback_helpers.h"
 #include "base/run_loop.h"
+#include "base/strings/string_piece.h"
 #include "content/public/browser/browser_task_traits.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/test/browser_task_environment.h"
@@ -136,6 +137,21 @@ TEST(TorControlTest, ReadLine) {
                      },
                      std::move(control)));
 
+  // Lines are views into the read buffer, without a terminating NUL.
+  control = std::make_unique<TorControl>(delegate.AsWeakPtr(), io_task_runner);
+  EXPECT_CALL(delegate, OnTorRawMid("250", "SOCKSPORT=9150")).Times(1);
+  EXPECT_CALL(delegate, OnTorRawEnd("250", "DONE")).Times(1);
+  io_task_runner->PostTask(
+      FROM_HERE,
+      base::BindOnce(
+          [](std::unique_ptr<TorControl> control) {
+            const base::StringPiece buffer =
+                "250-SOCKSPORT=9150\r\n250 DONE\r\n";
+            EXPECT_TRUE(control->ReadLine(buffer.substr(0, 18)));
+            EXPECT_TRUE(control->ReadLine(buffer.substr(20, 8)));
+          },
+          std::move(control)));
+
   // Test Async:
   control = std::make_unique<TorControl>(delegate.AsWeakPtr(), io_task_runner);
   using tor::TorControlEvent;
@@ -10,10 +10,9 @@
 
 #include "base/json/json_reader.h"
 #include "base/logging.h"
-#include "base/strings/string_split.h"
-#include "base/strings/string_util.h"
 #include "base/task/thread_pool.h"
 #include "base/values.h"
+#include "brave/components/url_sanitizer/common/query_string_stripper.h"
 #include "extensions/common/url_pattern.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 #include "url/gurl.h"
@@ -121,12 +120,19 @@ GURL URLSanitizerService::SanitizeURL(const GURL& initial_url) {
     return initial_url;
   GURL url = initial_url;
   for (const auto& it : matchers_) {
+    if (!url.has_query())
+      break;
     if (!it->include.MatchesURL(url) || it->exclude.MatchesURL(url))
       continue;
-    auto sanitized_query = StripQueryParameter(url.query(), it->params);
+    const auto sanitized_query =
+        StripQueryParameters(url.query_piece(), [&it](base::StringPiece key) {
+          return it->params.contains(key);
+        });
+    if (!sanitized_query)
+      continue;
     GURL::Replacements replacements;
-    if (!sanitized_query.empty()) {
-      replacements.SetQueryStr(sanitized_query);
+    if (!sanitized_query->empty()) {
+      replacements.SetQueryStr(*sanitized_query);
     } else {
       replacements.ClearQuery();
     }
@@ -139,39 +145,16 @@ void URLSanitizerService::OnRulesReady(const std::string& json_content) {
   Initialize(json_content);
 }
 
-// FIXME: merge with
-// browser/net/brave_site_hacks_network_delegate_helper.cc::StripQueryParameter()
 // Remove tracking query parameters from a GURL, leaving all
 // other parts untouched.
 std::string URLSanitizerService::StripQueryParameter(
     const std::string& query,
     const base::flat_set<std::string>& trackers) {
-  // We are using custom query string parsing code here. See
-  // https://github.com/brave/brave-core/pull/13726#discussion_r897712350
-  // for more information on why this approach was selected.
-  //
-  // Split query string by ampersands, remove tracking parameters,
-  // then join the remaining query parameters, untouched, back into
-  // a single query string.
-  const std::vector<std::string> input_kv_strings =
-      SplitString(query, "&", base::KEEP_WHITESPACE, base::SPLIT_WANT_ALL);
-  std::vector<std::string> output_kv_strings;
-  int disallowed_count = 0;
-  for (const std::string& kv_string : input_kv_strings) {
-    const std::vector<std::string> pieces = SplitString(
-        kv_string, "=", base::KEEP_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
-    const std::string& key = pieces.empty() ? std::string() : pieces[0];
-    if (pieces.size() >= 2 && trackers.count(key) == 1) {
-      ++disallowed_count;
-    } else {
-      output_kv_strings.push_back(kv_string);
-    }
-  }
-  if (disallowed_count > 0) {
-    return base::JoinString(output_kv_strings, "&");
-  } else {
-    return query;
-  }
+  return StripQueryParameters(query,
+                              [&trackers](base::StringPiece key) {
+                                return trackers.contains(key);
+                              })
+      .value_or(query);
 }
 
 }  // namespace brave
@@ -0,0 +1,69 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/url_sanitizer/common/query_string_stripper.h"
+
+#include <algorithm>
+
+namespace brave {
+
+namespace {
+
+// Returns the key of a "key=value" parameter, or absl::nullopt if the
+// parameter does not have both a key and a value. Empty pieces between '='
+// separators are skipped, so "key==value" has the key "key".
+absl::optional<base::StringPiece> GetStrippableKey(base::StringPiece param) {
+  const size_t key_begin = param.find_first_not_of('=');
+  if (key_begin == base::StringPiece::npos) {
+    return absl::nullopt;
+  }
+  const size_t key_end = param.find('=', key_begin);
+  if (key_end == base::StringPiece::npos ||
+      param.find_first_not_of('=', key_end) == base::StringPiece::npos) {
+    return absl::nullopt;
+  }
+  return param.substr(key_begin, key_end - key_begin);
+}
+
+}  // namespace
+
+absl::optional<std::string> StripQueryParameters(
+    base::StringPiece query,
+    base::FunctionRef<bool(base::StringPiece key)> should_strip) {
+  // Only allocated once the first parameter is stripped.
+  absl::optional<std::string> result;
+  bool has_output = false;
+
+  size_t begin = 0;
+  while (true) {
+    const size_t end = std::min(query.find('&', begin), query.size());
+    const base::StringPiece param = query.substr(begin, end - begin);
+
+    const absl::optional<base::StringPiece> key = GetStrippableKey(param);
+    if (key && should_strip(*key)) {
+      if (!result) {
+        // Keep everything before this parameter, without the separator.
+        result.emplace(query.substr(0, begin ? begin - 1 : 0));
+        result->reserve(query.size());
+        has_output = begin != 0;
+      }
+    } else if (result) {
+      if (has_output) {
+        result->push_back('&');
+      }
+      result->append(param.data(), param.size());
+      has_output = true;
+    }
+
+    if (end == query.size()) {
+      break;
+    }
+    begin = end + 1;
+  }
+
+  return result;
+}
+
+}  // namespace brave
@@ -0,0 +1,32 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_URL_SANITIZER_COMMON_QUERY_STRING_STRIPPER_H_
+#define BRAVE_COMPONENTS_URL_SANITIZER_COMMON_QUERY_STRING_STRIPPER_H_
+
+#include <string>
+
+#include "base/functional/function_ref.h"
+#include "base/strings/string_piece.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace brave {
+
+// Removes the "key=value" parameters of |query| whose key matches
+// |should_strip|, leaving all other parameters untouched, in a single pass.
+// Parameters without a non-empty value are never removed. Returns
+// absl::nullopt if nothing was removed, so callers only rebuild URLs that
+// changed.
+//
+// We are using custom query string parsing code here. See
+// https://github.com/brave/brave-core/pull/13726#discussion_r897712350
+// for more information on why this approach was selected.
+absl::optional<std::string> StripQueryParameters(
+    base::StringPiece query,
+    base::FunctionRef<bool(base::StringPiece key)> should_strip);
+
+}  // namespace brave
+
+#endif  // BRAVE_COMPONENTS_URL_SANITIZER_COMMON_QUERY_STRING_STRIPPER_H_
@@ -0,0 +1,55 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/url_sanitizer/common/query_string_stripper.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave {
+
+namespace {
+
+absl::optional<std::string> Strip(base::StringPiece query) {
+  return StripQueryParameters(query, [](base::StringPiece key) {
+    return key == "fbclid" || key == "second";
+  });
+}
+
+}  // namespace
+
+TEST(QueryStringStripperTest, NothingStripped) {
+  EXPECT_EQ(absl::nullopt, Strip(""));
+  EXPECT_EQ(absl::nullopt, Strip("param1=1"));
+  EXPECT_EQ(absl::nullopt, Strip("fbclid2=ok&&param1=1"));
+}
+
+TEST(QueryStringStripperTest, ParametersWithoutValueAreKept) {
+  EXPECT_EQ(absl::nullopt, Strip("fbclid"));
+  EXPECT_EQ(absl::nullopt, Strip("fbclid="));
+  EXPECT_EQ(absl::nullopt, Strip("=fbclid"));
+}
+
+TEST(QueryStringStripperTest, StripsMatchingParameters) {
+  EXPECT_EQ("param1=1", Strip("fbclid=11&param1=1&second=2"));
+  EXPECT_EQ("fbclid2=ok&&param1=1&foo;bar=yes",
+            Strip("fbclid2=ok&&param1=1&foo;bar=yes&second=2&fbclid=11"));
+  EXPECT_EQ("param1=1",
+            Strip("fbclid=11&fbclid=11&fbclid=22&param1=1&second=2&second=2"));
+  EXPECT_EQ("", Strip("fbclid=11"));
+}
+
+TEST(QueryStringStripperTest, KeepsEmptyParameters) {
+  EXPECT_EQ("&x", Strip("fbclid=1&&x"));
+  EXPECT_EQ("&y", Strip("&fbclid=1&y"));
+  EXPECT_EQ("a=1&&b=2", Strip("a=1&&b=2&fbclid=1"));
+}
+
+TEST(QueryStringStripperTest, SkipsEmptyKeyPieces) {
+  EXPECT_EQ("a=1", Strip("fbclid==1&a=1"));
+  EXPECT_EQ("a=1", Strip("=fbclid=1&a=1"));
+  EXPECT_EQ("a=1", Strip("fbclid=1=2&a=1"));
+}
+
+}  // namespace brave
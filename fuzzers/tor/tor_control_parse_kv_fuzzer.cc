@@ -0,0 +1,42 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include <string>
+
+#include "base/check_op.h"
+#include "base/strings/string_piece.h"
+#include "brave/components/tor/tor_control.h"
+
+namespace {
+
+// Exposes the reply parsers, which TorControl only makes available to itself
+// and its tests. Never instantiated.
+class TorControlParser : public tor::TorControl {
+ public:
+  using tor::TorControl::ParseKV;
+  using tor::TorControl::ParseQuoted;
+};
+
+}  // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+  // TorControl parses views into its read buffer, which are not
+  // NUL-terminated, so don't hand the parsers a std::string either.
+  const base::StringPiece reply(reinterpret_cast<const char*>(data), size);
+
+  std::string key, value;
+  size_t end = 0;
+  if (TorControlParser::ParseKV(reply, &key, &value, &end)) {
+    CHECK_LE(end, reply.size());
+    CHECK_LE(key.size() + value.size(), reply.size());
+  }
+  TorControlParser::ParseKV(reply, &key, &value);
+
+  if (TorControlParser::ParseQuoted(reply, &value, &end)) {
+    CHECK_LE(end, reply.size());
+    CHECK_LT(value.size(), reply.size());
+  }
+  return 0;
+}
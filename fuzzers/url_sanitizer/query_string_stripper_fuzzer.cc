@@ -0,0 +1,55 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include <fuzzer/FuzzedDataProvider.h>
+
+#include <string>
+#include <vector>
+
+#include "base/check_op.h"
+#include "base/strings/string_piece.h"
+#include "base/strings/string_split.h"
+#include "base/strings/string_util.h"
+#include "brave/components/url_sanitizer/common/query_string_stripper.h"
+
+namespace {
+
+// The split and join implementation StripQueryParameters replaced, used as the
+// reference the single pass implementation must agree with.
+absl::optional<std::string> ReferenceStripQueryParameters(
+    base::StringPiece query,
+    base::StringPiece tracker) {
+  std::vector<base::StringPiece> output_kv_strings;
+  bool stripped = false;
+  for (const auto& kv_string : base::SplitStringPiece(
+           query, "&", base::KEEP_WHITESPACE, base::SPLIT_WANT_ALL)) {
+    const std::vector<base::StringPiece> pieces = base::SplitStringPiece(
+        kv_string, "=", base::KEEP_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
+    if (pieces.size() >= 2 && pieces[0] == tracker) {
+      stripped = true;
+    } else {
+      output_kv_strings.push_back(kv_string);
+    }
+  }
+  if (!stripped) {
+    return absl::nullopt;
+  }
+  return base::JoinString(output_kv_strings, "&");
+}
+
+}  // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+  FuzzedDataProvider data_provider(data, size);
+
+  const std::string tracker = data_provider.ConsumeRandomLengthString(16);
+  const std::string query = data_provider.ConsumeRemainingBytesAsString();
+
+  const absl::optional<std::string> result = brave::StripQueryParameters(
+      query, [&tracker](base::StringPiece key) { return key == tracker; });
+  CHECK_EQ(result, ReferenceStripQueryParameters(query, tracker));
+
+  return 0;
+}
@@ -0,0 +1,105 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/core/brave_page_graph/libxml_dump_utils.h"
+
+#include <libxml/encoding.h>
+#include <libxml/xmlIO.h>
+
+#include "base/check.h"
+#include "base/check_op.h"
+#include "base/strings/strcat.h"
+
+namespace brave_page_graph {
+
+namespace {
+
+constexpr char kItemsPlaceholder[] = "streamed-items";
+
+// xmlOutputWriteCallback appending the serialized output to a std::string.
+int AppendToString(void* context, const char* buffer, int len) {
+  static_cast<std::string*>(context)->append(buffer, len);
+  return len;
+}
+
+std::string DumpXmlDoc(xmlDocPtr doc) {
+  xmlChar* xml_string = nullptr;
+  int size = 0;
+  xmlDocDumpMemoryEnc(doc, &xml_string, &size, "UTF-8");
+  std::string output(reinterpret_cast<const char*>(xml_string), size);
+  xmlFree(xml_string);
+  return output;
+}
+
+// Serializes and frees every child of |parent|.
+void DumpAndFreeChildren(xmlOutputBufferPtr output,
+                         xmlDocPtr doc,
+                         xmlNodePtr parent) {
+  while (xmlNodePtr child = parent->children) {
+    xmlNodeDumpOutput(output, doc, child, 0, 0, "UTF-8");
+    xmlUnlinkNode(child);
+    xmlFreeNode(child);
+  }
+}
+
+}  // namespace
+
+std::string DumpXmlDocWithStreamedItems(xmlDocPtr doc,
+                                        xmlNodePtr items_parent,
+                                        XmlItemWriter item_writer) {
+  DCHECK_EQ(items_parent->doc, doc);
+  DCHECK(!items_parent->children);
+
+  // Without items |items_parent| is an empty element, which the document dump
+  // writes as <name/>. Leave it to the document dump.
+  if (!item_writer(items_parent)) {
+    return DumpXmlDoc(doc);
+  }
+  DCHECK(items_parent->children);
+
+  // Dump the document with the first item and a placeholder after it, then
+  // replace the placeholder with the remaining items. The placeholder is a
+  // comment, which can't appear in escaped text or attribute values.
+  xmlNodePtr placeholder_node =
+      xmlAddChild(items_parent, xmlNewComment(BAD_CAST kItemsPlaceholder));
+  std::string output = DumpXmlDoc(doc);
+  xmlUnlinkNode(placeholder_node);
+  xmlFreeNode(placeholder_node);
+
+  const std::string placeholder =
+      base::StrCat({"<!--", kItemsPlaceholder, "-->"});
+  const size_t placeholder_pos = output.rfind(placeholder);
+  CHECK_NE(placeholder_pos, std::string::npos);
+  const std::string output_end =
+      output.substr(placeholder_pos + placeholder.size());
+  output.resize(placeholder_pos);
+
+  // The first item is already in |output|.
+  while (xmlNodePtr child = items_parent->children) {
+    xmlUnlinkNode(child);
+    xmlFreeNode(child);
+  }
+
+  // Items are written with the same serializer and options as the document
+  // dump, so they come out exactly as they would inside it. The document dump
+  // also sets the document encoding while it runs; without it, non-ASCII
+  // characters in attribute values are written as character references.
+  const xmlChar* const doc_encoding = doc->encoding;
+  doc->encoding = BAD_CAST "UTF-8";
+  xmlOutputBufferPtr xml_output =
+      xmlOutputBufferCreateIO(&AppendToString, nullptr, &output,
+                              xmlFindCharEncodingHandler("UTF-8"));
+  while (item_writer(items_parent)) {
+    DCHECK(items_parent->children);
+    DumpAndFreeChildren(xml_output, doc, items_parent);
+  }
+  xmlOutputBufferClose(xml_output);
+  doc->encoding = doc_encoding;
+
+  output += output_end;
+  return output;
+}
+
+}  // namespace brave_page_graph
@@ -0,0 +1,32 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_LIBXML_DUMP_UTILS_H_
+#define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_LIBXML_DUMP_UTILS_H_
+
+#include <libxml/tree.h>
+
+#include <string>
+
+#include "base/functional/function_ref.h"
+
+namespace brave_page_graph {
+
+// Adds the elements of the next item to |parent| and returns true, or returns
+// false once there are no items left. An item must add at least one element.
+using XmlItemWriter = base::FunctionRef<bool(xmlNodePtr parent)>;
+
+// Returns the same UTF-8 output as xmlDocDumpMemoryEnc(|doc|, ..., "UTF-8")
+// would for |doc| with every item from |item_writer| appended to
+// |items_parent|. Each item is serialized and freed before the next one is
+// added, so the tree never holds more than one item. |items_parent| must
+// belong to |doc| and have no children.
+std::string DumpXmlDocWithStreamedItems(xmlDocPtr doc,
+                                        xmlNodePtr items_parent,
+                                        XmlItemWriter item_writer);
+
+}  // namespace brave_page_graph
+
+#endif  // BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_LIBXML_DUMP_UTILS_H_
@@ -0,0 +1,133 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/core/brave_page_graph/libxml_dump_utils.h"
+
+#include <libxml/tree.h>
+
+#include <string>
+#include <vector>
+
+#include "base/strings/string_number_conversions.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_page_graph {
+
+namespace {
+
+struct TestItem {
+  std::string id;
+  std::string text;
+  // Adds a second element, like HTML element nodes adding structure edges.
+  bool with_edge = false;
+};
+
+// Holds a document shaped like Page Graph's GraphML output.
+class TestDoc {
+ public:
+  TestDoc() {
+    doc_ = xmlNewDoc(BAD_CAST "1.0");
+    xmlNodePtr root = xmlNewNode(nullptr, BAD_CAST "graphml");
+    xmlDocSetRootElement(doc_, root);
+    xmlNewNs(root, BAD_CAST "http://graphml.graphdrawing.org/xmlns", nullptr);
+    xmlNodePtr desc = xmlNewChild(root, nullptr, BAD_CAST "desc", nullptr);
+    xmlNewTextChild(desc, nullptr, BAD_CAST "about",
+                    BAD_CAST "https://example.com/?a=1&b=<2>");
+    graph_ = xmlNewChild(root, nullptr, BAD_CAST "graph", nullptr);
+    xmlSetProp(graph_, BAD_CAST "id", BAD_CAST "G");
+  }
+  ~TestDoc() { xmlFreeDoc(doc_); }
+
+  TestDoc(const TestDoc&) = delete;
+  TestDoc& operator=(const TestDoc&) = delete;
+
+  xmlDocPtr doc() const { return doc_; }
+  xmlNodePtr graph() const { return graph_; }
+
+  void AddItem(const TestItem& item, xmlNodePtr parent) {
+    xmlNodePtr node = xmlNewChild(parent, nullptr, BAD_CAST "node", nullptr);
+    xmlSetProp(node, BAD_CAST "id", BAD_CAST item.id.c_str());
+    xmlNodePtr data = xmlNewTextChild(node, nullptr, BAD_CAST "data",
+                                      BAD_CAST item.text.c_str());
+    xmlSetProp(data, BAD_CAST "key", BAD_CAST item.text.c_str());
+    if (item.with_edge) {
+      xmlNodePtr edge =
+          xmlNewChild(parent, nullptr, BAD_CAST "edge", nullptr);
+      xmlSetProp(edge, BAD_CAST "source", BAD_CAST item.id.c_str());
+    }
+  }
+
+ private:
+  xmlDocPtr doc_;
+  xmlNodePtr graph_;
+};
+
+std::string DumpWholeDoc(const std::vector<TestItem>& items) {
+  TestDoc test_doc;
+  for (const auto& item : items) {
+    test_doc.AddItem(item, test_doc.graph());
+  }
+  xmlChar* xml_string = nullptr;
+  int size = 0;
+  xmlDocDumpMemoryEnc(test_doc.doc(), &xml_string, &size, "UTF-8");
+  std::string output(reinterpret_cast<const char*>(xml_string), size);
+  xmlFree(xml_string);
+  return output;
+}
+
+std::string DumpStreamed(const std::vector<TestItem>& items) {
+  TestDoc test_doc;
+  auto item_it = items.begin();
+  return DumpXmlDocWithStreamedItems(
+      test_doc.doc(), test_doc.graph(), [&](xmlNodePtr parent) {
+        if (item_it == items.end()) {
+          return false;
+        }
+        test_doc.AddItem(*item_it++, parent);
+        // Only the current item may be in the tree.
+        EXPECT_EQ(xmlChildElementCount(parent),
+                  (item_it - 1)->with_edge ? 2u : 1u);
+        return true;
+      });
+}
+
+}  // namespace
+
+TEST(LibxmlDumpUtilsTest, NoItems) {
+  const std::string streamed = DumpStreamed({});
+  EXPECT_EQ(DumpWholeDoc({}), streamed);
+  EXPECT_NE(streamed.find("<graph id=\"G\"/>"), std::string::npos);
+}
+
+TEST(LibxmlDumpUtilsTest, OneItem) {
+  const std::vector<TestItem> items = {{"n0", "text"}};
+  EXPECT_EQ(DumpWholeDoc(items), DumpStreamed(items));
+}
+
+TEST(LibxmlDumpUtilsTest, MatchesWholeDocumentDump) {
+  const std::vector<TestItem> items = {
+      {"n0", "plain"},
+      {"n1", "<script>&amp;\"quoted\" 'single'</script>", true},
+      {"n2", "caf\xC3\xA9 \xF0\x9F\x98\x80 \xE2\x80\x8B"},
+      {"n3", "tab\tnew\nline\rreturn", true},
+      {"n4", "<!--streamed-items-->"},
+      {"n5", ""},
+  };
+  const std::string whole_doc = DumpWholeDoc(items);
+  EXPECT_EQ(whole_doc, DumpStreamed(items));
+  EXPECT_EQ(whole_doc.rfind("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n", 0),
+            0u);
+}
+
+TEST(LibxmlDumpUtilsTest, ManyItems) {
+  std::vector<TestItem> items;
+  for (int i = 0; i < 1000; ++i) {
+    items.push_back({"n" + base::NumberToString(i),
+                     "value & <" + base::NumberToString(i) + ">", i % 3 == 0});
+  }
+  EXPECT_EQ(DumpWholeDoc(items), DumpStreamed(items));
+}
+
+}  // namespace brave_page_graph
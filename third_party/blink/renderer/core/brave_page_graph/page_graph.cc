@@ -80,6 +80,7 @@
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/storage/node_storage_root.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/storage/node_storage_sessionstorage.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graphml.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/libxml_dump_utils.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/libxml_utils.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/requests/request_tracker.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/requests/tracked_request.h"
@@ -1018,22 +1019,27 @@ String PageGraph::ToGraphML() const {
   xmlSetProp(graph_node, BAD_CAST "id", BAD_CAST "G");
   xmlSetProp(graph_node, BAD_CAST "edgedefault", BAD_CAST "directed");
 
-  for (const auto* node : nodes_) {
-    node->AddGraphMLTag(graphml_doc, graph_node);
-  }
-  for (const auto* edge : edges_) {
-    edge->AddGraphMLTag(graphml_doc, graph_node);
-  }
+  // Graph items are not all added to the document, which would keep a libxml
+  // tree of the whole graph in memory. They are added and serialized one at a
+  // time instead.
+  auto node_it = nodes_.begin();
+  auto edge_it = edges_.begin();
+  const std::string graphml = DumpXmlDocWithStreamedItems(
+      graphml_doc, graph_node, [&](xmlNodePtr parent) {
+        if (node_it != nodes_.end()) {
+          (*node_it++)->AddGraphMLTag(graphml_doc, parent);
+          return true;
+        }
+        if (edge_it != edges_.end()) {
+          (*edge_it++)->AddGraphMLTag(graphml_doc, parent);
+          return true;
+        }
+        return false;
+      });
+  xmlFreeDoc(graphml_doc);
 
-  xmlChar* xml_string;
-  int size;
-  xmlDocDumpMemoryEnc(graphml_doc, &xml_string, &size, "UTF-8");
-  auto graphml_string = String::FromUTF8(xml_string, size);
+  auto graphml_string = String::FromUTF8(graphml.data(), graphml.size());
   DCHECK(!graphml_string.empty());
-
-  xmlFree(xml_string);
-  xmlFree(graphml_doc);
-
   return graphml_string;
 }
 